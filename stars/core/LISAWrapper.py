@@ -11,7 +11,8 @@ import ctypes
 import numpy as np
 import os
 
-def call_lisa(data, weight_file, numPermutations):
+def call_lisa(data, weight_file, numPermutations, compressed=False,
+              reorder=False):
     n = len(data)
     
     # validate data and weight_file
@@ -57,6 +58,20 @@ def call_lisa(data, weight_file, numPermutations):
         return None
         
     weights = wfile.gal
+    if compressed:
+        # varint packed rows (GalCompressed): a fraction of the memory of
+        # the GalElement rows, which are released here
+        weights = GalCompressed()
+        weights.Build(wfile.gal, n)
+        del wfile
+    elif reorder:
+        # rows renumbered in reverse Cuthill-McKee order (GalReorder), the
+        # data are permuted once and the results come back in record order;
+        # it speeds up the lag of the observed data, not the permutations,
+        # which draw at random in any order (see benchmark_reorder)
+        weights = GalReorder()
+        weights.BuildRCM(wfile.gal, n)
+        del wfile
    
     # call lisa
     GeodaLisa_LISA(
@@ -86,7 +101,71 @@ def call_lisa(data, weight_file, numPermutations):
     
     return _localMoran, _sigLocalMoran, _sigFlag, _clusterFlag
     
+def benchmark_reorder(side=1000, passes=20, permutations=99):
+    """
+    Times GalReorder against record order on a side x side queen lattice
+    whose records are shuffled, as they are in many shape files: the
+    Build, passes SpatialLagAll calls and one LISA with permutations,
+    for the record (identity), Hilbert and RCM orders.
+    """
+    import random, tempfile, time
+    n = side * side
+    rec = range(n)
+    random.seed(1)
+    random.shuffle(rec)          # rec[record] = cell
+    pos = [0] * n                # pos[cell] = record
+    for r in range(n):
+        pos[rec[r]] = r
+    fd, gal = tempfile.mkstemp('.gal')
+    o = os.fdopen(fd, 'w')
+    o.write('%d\n' % n)
+    for r in range(n):
+        i, j = divmod(rec[r], side)
+        nbrs = [pos[a * side + b]
+                for a in range(max(i-1, 0), min(i+2, side))
+                for b in range(max(j-1, 0), min(j+2, side))
+                if a != i or b != j]
+        o.write('%d %d\n%s\n' % (r, len(nbrs), ' '.join(map(str, nbrs))))
+    o.close()
+    wfile = GalWeight(gal)
+    os.remove(gal)
+
+    xs = VecDouble([float(rec[r] % side) for r in range(n)])
+    ys = VecDouble([float(rec[r] / side) for r in range(n)])
+    x = doubleArray(n)
+    for r in range(n):
+        x[r] = random.random()
+    lag = doubleArray(n)
+    sig = doubleArray(n)
+    flag = intArray(n)
+    cluster = intArray(n)
+    builds = [('record', lambda w: w.Build(wfile.gal, n, VecInt(range(n)))),
+              ('hilbert', lambda w: w.BuildHilbert(wfile.gal, xs, ys)),
+              ('rcm', lambda w: w.BuildRCM(wfile.gal, n))]
+    for name, build in builds:
+        w = GalReorder()
+        t = time.time()
+        build(w)
+        t_build = time.time() - t
+        t = time.time()
+        for p in range(passes):
+            w.SpatialLagAll(x, lag, True)
+        t_lag = time.time() - t
+        data = doubleArray(n)
+        for r in range(n):
+            data[r] = x[r]
+        lm = VecDouble([0] * n)
+        t = time.time()
+        GeodaLisa_LISA(n, data, w, permutations, lm, sig, flag, cluster)
+        t_lisa = time.time() - t
+        print '%-8s build %6.2fs  %d lags %6.2fs  lisa(%d) %6.2fs' % \
+            (name, t_build, passes, t_lag, permutations, t_lisa)
+
 if __name__=='__main__':
+    import sys
+    if len(sys.argv) > 1 and sys.argv[1] == 'bench':
+        benchmark_reorder(*[int(a) for a in sys.argv[2:]])
+        sys.exit(0)
     #data = [16, 22, 28, 22, 19, 14, 27, 42, 17,  5, 27, 28, 16, 13,  9]
     #localMoran, sigLM, sigFlag, clusterFlag = call_lisa(data,'Data_and_Rates_for_Beats.gal', 999)
     import pysal
@@ -12,33 +12,27 @@
 #include <vector>
 #include "Randik.h"
 #include "GalWeight.h"
+#include "../og/ShapeOperations/GalLattice.h"
+#include "../og/ShapeOperations/GalSubset.h"
+#include "../og/ShapeOperations/GalCompressed.h"
+#include "../og/ShapeOperations/GalReorder.h"
 //#include "GwtWeight.h"
 #include "Lisa.h"
 #include <iostream>
 
-bool GeodaLisa::LISA(int		nObs,				  // The size of data
-					 double*	Data,				  // The input data 
-					 GalElement* W,					  // The weight
-					 const int numPermutations,		  // The number of permutation
-					 std::vector<double>& localMoran, // The LISA
-					 double*	sigLocalMoran,	      // The significances
-					 int*		sigFlag,			  // The significance category
-					 int*		cluster)		      // The Cluster (HH,LL,LH,HL)
-
-{    
+/** the LISA of Data, for any weights W where W[cnt] has Size() and
+ SpatialLag(): a GalElement array, a GalLattice, a GalSubset, a
+ GalCompressed or a GalReorder */
+template <class Weights>
+static bool LocalMoran(int nObs, double* Data, const Weights& W,
+					   const int numPermutations,
+					   std::vector<double>& localMoran,
+					   double* sigLocalMoran, int* sigFlag, int* cluster)
+{
 	StandardizeData(nObs, Data);	
 	OgSet workPermutation(nObs);     
 	Randik  rng;
 
-	if (!Data || !sigLocalMoran || ! sigFlag || !W) 
-	{
-		delete [] sigLocalMoran;
-		sigLocalMoran = NULL;
-		delete [] sigFlag;
-		sigFlag = NULL;
-		return false;
-	}
-	
 	for (int cnt= 0; cnt < nObs; ++cnt)  
 	{
 		const int numNeighbors = W[cnt].Size();
@@ -104,6 +98,98 @@ bool GeodaLisa::LISA(int		nObs,				  // The size of data
 	return true;
 }
 
+bool GeodaLisa::LISA(int		nObs,				  // The size of data
+					 double*	Data,				  // The input data 
+					 GalElement* W,					  // The weight
+					 const int numPermutations,		  // The number of permutation
+					 std::vector<double>& localMoran, // The LISA
+					 double*	sigLocalMoran,	      // The significances
+					 int*		sigFlag,			  // The significance category
+					 int*		cluster)		      // The Cluster (HH,LL,LH,HL)
+
+{    
+	if (!Data || !sigLocalMoran || ! sigFlag || !W) 
+	{
+		delete [] sigLocalMoran;
+		sigLocalMoran = NULL;
+		delete [] sigFlag;
+		sigFlag = NULL;
+		return false;
+	}
+	return LocalMoran(nObs, Data, W, numPermutations, localMoran,
+					  sigLocalMoran, sigFlag, cluster);
+}
+
+bool GeodaLisa::LISA(int nObs,
+					 double* Data,
+					 const GalLattice& W,
+					 const int numPermutations,
+					 std::vector<double>& localMoran,
+					 double* sigLocalMoran,
+					 int* sigFlag,
+					 int* cluster)
+{
+	if (!Data || !sigLocalMoran || ! sigFlag || nObs != W.NumObs())
+		return false;
+	return LocalMoran(nObs, Data, W, numPermutations, localMoran,
+					  sigLocalMoran, sigFlag, cluster);
+}
+
+bool GeodaLisa::LISA(int nObs,
+					 double* Data,
+					 const GalSubset& W,
+					 const int numPermutations,
+					 std::vector<double>& localMoran,
+					 double* sigLocalMoran,
+					 int* sigFlag,
+					 int* cluster)
+{
+	if (!Data || !sigLocalMoran || ! sigFlag || nObs != W.NumObs())
+		return false;
+	return LocalMoran(nObs, Data, W, numPermutations, localMoran,
+					  sigLocalMoran, sigFlag, cluster);
+}
+
+bool GeodaLisa::LISA(int nObs,
+					 double* Data,
+					 const GalCompressed& W,
+					 const int numPermutations,
+					 std::vector<double>& localMoran,
+					 double* sigLocalMoran,
+					 int* sigFlag,
+					 int* cluster)
+{
+	if (!Data || !sigLocalMoran || ! sigFlag || nObs != W.NumObs())
+		return false;
+	return LocalMoran(nObs, Data, W, numPermutations, localMoran,
+					  sigLocalMoran, sigFlag, cluster);
+}
+
+bool GeodaLisa::LISA(int nObs,
+					 double* Data,
+					 const GalReorder& W,
+					 const int numPermutations,
+					 std::vector<double>& localMoran,
+					 double* sigLocalMoran,
+					 int* sigFlag,
+					 int* cluster)
+{
+	if (!Data || !sigLocalMoran || ! sigFlag || nObs != W.NumObs())
+		return false;
+	// permuted once on the way in, un-permuted once on the way out
+	std::vector<double> data(nObs), lisa(nObs), sig(nObs);
+	std::vector<int> flag(nObs), clus(nObs);
+	W.Permute(Data, &data[0]);
+	LocalMoran(nObs, &data[0], W, numPermutations, lisa, &sig[0], &flag[0],
+			   &clus[0]);
+	W.Unpermute(&data[0], Data); // standardized, as by the other overloads
+	W.Unpermute(&lisa[0], &localMoran[0]);
+	W.Unpermute(&sig[0], sigLocalMoran);
+	W.Unpermute(&flag[0], sigFlag);
+	W.Unpermute(&clus[0], cluster);
+	return true;
+}
+
 
 bool GeodaLisa::LISA(int nObs,
 					 DataPoint*	RawData,
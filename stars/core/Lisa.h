@@ -17,6 +17,10 @@
 #include <cstring>
 
 class GalElement;
+class GalLattice;
+class GalSubset;
+class GalCompressed;
+class GalReorder;
 struct DataPoint;
 
 inline void DevFromMean(int nObs, double* RawData)
@@ -104,6 +108,53 @@ public:
 					 double* sigLocalMoran,		// The significances
 					 int* sigFlag,				// The significance category
 					 int* clusterFlag);			// The Cluster (HH,LL,LH,HL)
+
+	/** LISA with implicit rook/queen lattice weights; nObs must equal
+	 weights.NumObs() */
+	static bool LISA(int nObs,					// The size of data
+					 double* Data,				// The input data 
+					 const GalLattice& weights,	// The weight
+					 const int numPermutations, // The number of permutation
+					 std::vector<double>& localMoran, // The LISA
+					 double* sigLocalMoran,		// The significances
+					 int* sigFlag,				// The significance category
+					 int* clusterFlag);			// The Cluster (HH,LL,LH,HL)
+
+	/** LISA on a selection of the observations: Data holds the selected
+	 values in subset order, nObs must equal weights.NumObs() */
+	static bool LISA(int nObs,					// The size of data
+					 double* Data,				// The input data 
+					 const GalSubset& weights,	// The weight
+					 const int numPermutations, // The number of permutation
+					 std::vector<double>& localMoran, // The LISA
+					 double* sigLocalMoran,		// The significances
+					 int* sigFlag,				// The significance category
+					 int* clusterFlag);			// The Cluster (HH,LL,LH,HL)
+
+	/** LISA with delta/varint compressed weights, for layers too large
+	 for GalElement rows; nObs must equal weights.NumObs() */
+	static bool LISA(int nObs,					// The size of data
+					 double* Data,				// The input data 
+					 const GalCompressed& weights, // The weight
+					 const int numPermutations, // The number of permutation
+					 std::vector<double>& localMoran, // The LISA
+					 double* sigLocalMoran,		// The significances
+					 int* sigFlag,				// The significance category
+					 int* clusterFlag);			// The Cluster (HH,LL,LH,HL)
+
+	/** LISA with the weights and data in a locality friendly order
+	 (GalReorder); Data and the results stay in record order.  The
+	 permutation draws are as many but land on other observations, so
+	 the pseudo p-values agree with record order only in distribution;
+	 nObs must equal weights.NumObs() */
+	static bool LISA(int nObs,					// The size of data
+					 double* Data,				// The input data 
+					 const GalReorder& weights,	// The weight
+					 const int numPermutations, // The number of permutation
+					 std::vector<double>& localMoran, // The LISA
+					 double* sigLocalMoran,		// The significances
+					 int* sigFlag,				// The significance category
+					 int* clusterFlag);			// The Cluster (HH,LL,LH,HL)
 		
 	static bool LISA(int nObs,					// The size of data
 					 DataPoint* RawData,		// The input data 
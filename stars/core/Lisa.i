@@ -10,6 +10,10 @@
 #include "GeoDaConst.h"
 #include "Randik.h"
 #include "GalWeight.h"
+#include "../og/ShapeOperations/GalLattice.h"
+#include "../og/ShapeOperations/GalSubset.h"
+#include "../og/ShapeOperations/GalCompressed.h"
+#include "../og/ShapeOperations/GalReorder.h"
 #include "Lisa.h"
 %}
 
@@ -23,6 +27,85 @@ namespace std {
   %template(VecVecUINT8) vector<vector<unsigned char> >;
 }
 
+/* og/ShapeOperations/GalLattice.h, as far as Python uses it */
+class GalLattice {
+public:
+	GalLattice(const long rows, const long cols, const bool queen);
+	bool SetMask(const std::vector<unsigned char>& empty);
+	bool HasMask() const;
+	long NumObs() const;
+	long Rows() const;
+	long Cols() const;
+	bool IsQueen() const;
+	long Cell(const long obs) const;
+	long Obs(const long cell) const;
+	long Size(const long obs) const;
+	void SpatialLagAll(const double* x, double* lag, const bool std) const;
+};
+
+/* og/ShapeOperations/GalSubset.h; from Python the selection is a
+ VecInt of parent ids */
+class GalSubset {
+public:
+	GalSubset();
+	long NumObs() const;
+	long Parent(const long sub) const;
+	long Sub(const long obs) const;
+	long Size(const long sub) const;
+	long SharedRows() const;
+};
+
+%extend GalSubset {
+	bool Build(const GalElement* W, const long obs,
+			   const std::vector<int>& selected) {
+		std::vector<long> ids(selected.begin(), selected.end());
+		return self->Build(W, obs, ids);
+	}
+}
+
+/* og/ShapeOperations/GalCompressed.h; Build packs GalElement rows, which
+ can be released afterwards */
+class GalCompressed {
+public:
+	GalCompressed();
+	long NumObs() const;
+	size_t Bytes() const;
+	long Size(const long obs) const;
+};
+
+%extend GalCompressed {
+	bool Build(const GalElement* W, const long obs) {
+		return self->Build(W, obs);
+	}
+}
+
+/* og/ShapeOperations/GalReorder.h; the Build calls permute GalElement
+ rows, which can be released afterwards */
+class GalReorder {
+public:
+	GalReorder();
+	long NumObs() const;
+	long Order(const long pos) const;
+	long Rank(const long obs) const;
+	long Size(const long pos) const;
+	void SpatialLagAll(const double* x, double* lag, const bool std) const;
+};
+
+%extend GalReorder {
+	bool Build(const GalElement* W, const long obs,
+			   const std::vector<int>& order) {
+		std::vector<long> ord(order.begin(), order.end());
+		return self->Build(W, obs, ord);
+	}
+	bool BuildRCM(const GalElement* W, const long obs) {
+		return self->BuildRCM(W, obs);
+	}
+	bool BuildHilbert(const GalElement* W, const std::vector<double>& x,
+					  const std::vector<double>& y) {
+		return self->BuildHilbert(W, x, y);
+	}
+}
+
 /*
  *  Lisa.h
  *  OpenGeoDa
@@ -39,6 +122,9 @@ namespace std {
 
 #include <vector>
 class GalElement;
+class GalLattice;
+class GalSubset;
+class GalCompressed;
 struct DataPoint;
 
 inline void DevFromMean(int nObs, double* RawData)
@@ -123,6 +209,39 @@ public:
 					 double* sigLocalMoran,		// The significances
 					 int* sigFlag,				// The significance category
 					 int* clusterFlag);			// The Cluster (HH,LL,LH,HL)
+
+	/** LISA with implicit rook/queen lattice weights; nObs must equal
+	 weights.NumObs() */
+	static bool LISA(int nObs,					// The size of data
+					 double* Data,				// The input data 
+					 const GalLattice& weights,	// The weight
+					 const int numPermutations, // The number of permutation
+					 std::vector<double>& localMoran, // The LISA
+					 double* sigLocalMoran,		// The significances
+					 int* sigFlag,				// The significance category
+					 int* clusterFlag);			// The Cluster (HH,LL,LH,HL)
+
+	/** LISA on a selection of the observations: Data holds the selected
+	 values in subset order, nObs must equal weights.NumObs() */
+	static bool LISA(int nObs,					// The size of data
+					 double* Data,				// The input data 
+					 const GalSubset& weights,	// The weight
+					 const int numPermutations, // The number of permutation
+					 std::vector<double>& localMoran, // The LISA
+					 double* sigLocalMoran,		// The significances
+					 int* sigFlag,				// The significance category
+					 int* clusterFlag);			// The Cluster (HH,LL,LH,HL)
+
+	/** LISA with delta/varint compressed weights, for layers too large
+	 for GalElement rows; nObs must equal weights.NumObs() */
+	static bool LISA(int nObs,					// The size of data
+					 double* Data,				// The input data 
+					 const GalCompressed& weights, // The weight
+					 const int numPermutations, // The number of permutation
+					 std::vector<double>& localMoran, // The LISA
+					 double* sigLocalMoran,		// The significances
+					 int* sigFlag,				// The significance category
+					 int* clusterFlag);			// The Cluster (HH,LL,LH,HL)
 		
 	static bool LISA(int nObs,					// The size of data
 					 DataPoint* RawData,		// The input data 
@@ -394,6 +394,94 @@ class VecVecUINT8(_object):
 VecVecUINT8_swigregister = _lisa.VecVecUINT8_swigregister
 VecVecUINT8_swigregister(VecVecUINT8)
 
+class GalLattice(_object):
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, GalLattice, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, GalLattice, name)
+    __repr__ = _swig_repr
+    def __init__(self, *args): 
+        this = _lisa.new_GalLattice(*args)
+        try: self.this.append(this)
+        except: self.this = this
+    def SetMask(*args): return _lisa.GalLattice_SetMask(*args)
+    def HasMask(*args): return _lisa.GalLattice_HasMask(*args)
+    def NumObs(*args): return _lisa.GalLattice_NumObs(*args)
+    def Rows(*args): return _lisa.GalLattice_Rows(*args)
+    def Cols(*args): return _lisa.GalLattice_Cols(*args)
+    def IsQueen(*args): return _lisa.GalLattice_IsQueen(*args)
+    def Cell(*args): return _lisa.GalLattice_Cell(*args)
+    def Obs(*args): return _lisa.GalLattice_Obs(*args)
+    def Size(*args): return _lisa.GalLattice_Size(*args)
+    def SpatialLagAll(*args): return _lisa.GalLattice_SpatialLagAll(*args)
+    __swig_destroy__ = _lisa.delete_GalLattice
+    __del__ = lambda self : None;
+GalLattice_swigregister = _lisa.GalLattice_swigregister
+GalLattice_swigregister(GalLattice)
+
+class GalSubset(_object):
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, GalSubset, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, GalSubset, name)
+    __repr__ = _swig_repr
+    def __init__(self, *args): 
+        this = _lisa.new_GalSubset(*args)
+        try: self.this.append(this)
+        except: self.this = this
+    def NumObs(*args): return _lisa.GalSubset_NumObs(*args)
+    def Parent(*args): return _lisa.GalSubset_Parent(*args)
+    def Sub(*args): return _lisa.GalSubset_Sub(*args)
+    def Size(*args): return _lisa.GalSubset_Size(*args)
+    def SharedRows(*args): return _lisa.GalSubset_SharedRows(*args)
+    def Build(*args): return _lisa.GalSubset_Build(*args)
+    __swig_destroy__ = _lisa.delete_GalSubset
+    __del__ = lambda self : None;
+GalSubset_swigregister = _lisa.GalSubset_swigregister
+GalSubset_swigregister(GalSubset)
+
+class GalCompressed(_object):
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, GalCompressed, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, GalCompressed, name)
+    __repr__ = _swig_repr
+    def __init__(self, *args): 
+        this = _lisa.new_GalCompressed(*args)
+        try: self.this.append(this)
+        except: self.this = this
+    def NumObs(*args): return _lisa.GalCompressed_NumObs(*args)
+    def Bytes(*args): return _lisa.GalCompressed_Bytes(*args)
+    def Size(*args): return _lisa.GalCompressed_Size(*args)
+    def Build(*args): return _lisa.GalCompressed_Build(*args)
+    __swig_destroy__ = _lisa.delete_GalCompressed
+    __del__ = lambda self : None;
+GalCompressed_swigregister = _lisa.GalCompressed_swigregister
+GalCompressed_swigregister(GalCompressed)
+
+class GalReorder(_object):
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, GalReorder, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, GalReorder, name)
+    __repr__ = _swig_repr
+    def __init__(self, *args): 
+        this = _lisa.new_GalReorder(*args)
+        try: self.this.append(this)
+        except: self.this = this
+    def NumObs(*args): return _lisa.GalReorder_NumObs(*args)
+    def Order(*args): return _lisa.GalReorder_Order(*args)
+    def Rank(*args): return _lisa.GalReorder_Rank(*args)
+    def Size(*args): return _lisa.GalReorder_Size(*args)
+    def SpatialLagAll(*args): return _lisa.GalReorder_SpatialLagAll(*args)
+    def Build(*args): return _lisa.GalReorder_Build(*args)
+    def BuildRCM(*args): return _lisa.GalReorder_BuildRCM(*args)
+    def BuildHilbert(*args): return _lisa.GalReorder_BuildHilbert(*args)
+    __swig_destroy__ = _lisa.delete_GalReorder
+    __del__ = lambda self : None;
+GalReorder_swigregister = _lisa.GalReorder_swigregister
+GalReorder_swigregister(GalReorder)
+
 DevFromMean = _lisa.DevFromMean
 StandardizeData = _lisa.StandardizeData
 class OgSet(_object):
@@ -29,7 +29,10 @@ extensions = [Extension('_mt_densitymap',
                         sources=['mt_densitymap_wrap.cpp', 'mt_densitymap.cpp'],
                         ),
               Extension('_lisa',
-                        sources=['Lisa_wrap.cpp', 'Lisa.cpp', 'Randik.cpp', 'GalWeight.cpp'],
+                        sources=['Lisa_wrap.cpp', 'Lisa.cpp', 'Randik.cpp', 'GalWeight.cpp',
+                                 '../og/ShapeOperations/GalLattice.cpp',
+                                 '../og/ShapeOperations/GalCompressed.cpp',
+                                 '../og/ShapeOperations/GalReorder.cpp'],
                         ),
               Extension('_weights',
                         sources=['Weight_wrap.cxx', 'GalWeight.cpp','GwtWeight.cpp'],
@@ -265,7 +265,8 @@ class CShapeFileObject():
         #stars.SHAPE_LOCATOR_INDEX = None
         self.loadDBF(path)
         
-        self.get_kdtree_locator()
+        # the kd-tree of centroids is built by get_kdtree_locator() when a
+        # query first needs it, not on every open
            
         #self.read_project_file(path)
         # NOTE: quadtree is faster here, but kdtree must be used
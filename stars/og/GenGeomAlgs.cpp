@@ -50,6 +50,30 @@ double GenGeomAlgs::ComputeArcDist(double long1, double lat1,
 	return dist;  // in miles
 }
 
+void GenGeomAlgs::LonLatToUnit(double lon, double lat, double* xyz)
+{
+	const double rad = 0.017453292519938; // rad = pi/180.0
+	double colat = (90.0 - lat) * rad;
+	double rlong = lon * rad;
+	xyz[0] = sin(colat) * cos(rlong);
+	xyz[1] = sin(colat) * sin(rlong);
+	xyz[2] = cos(colat);
+}
+
+double GenGeomAlgs::ChordToArcDist(double chord, double radius)
+{
+	double half = chord / 2;
+	if (half > 1) half = 1;
+	return 2 * asin(half) * radius;
+}
+
+double GenGeomAlgs::ArcDistToChord(double arc, double radius)
+{
+	double angle = arc / radius;
+	if (angle >= 3.14159265358979) return 2.0;
+	return 2 * sin(angle / 2);
+}
+
 /*
  * Fhe following four functions: findArea, ComputeArea2D,
  *     and ComputePerimeter2D are borrowed from FastArea.c++
@@ -35,6 +35,17 @@
 namespace GenGeomAlgs {
 	double ComputeEucDist(double x1, double y1, double x2, double y2);
 	double ComputeArcDist(double lat1, double long1, double lat2, double long2);
+	/** earth radius of ComputeArcDist (miles), and in kilometers */
+	const double EarthRadiusMi = 3959.0;
+	const double EarthRadiusKm = 6371.0;
+	/** point on the unit sphere of the longitude and latitude (degrees);
+	 the chord between two of them grows with their arc distance */
+	void LonLatToUnit(double lon, double lat, double* xyz);
+	/** arc distance, in units of radius, spanned by a chord between two
+	 points on the unit sphere */
+	double ChordToArcDist(double chord, double radius= EarthRadiusMi);
+	/** chord spanning an arc distance; 2 from half the circumference on */
+	double ArcDistToChord(double arc, double radius= EarthRadiusMi);
 	double ComputePerimeter2D(int n, double *x, double *y);
 	double ComputeArea2D(int n, double *x, double *y);    // output unit normal
 	double findArea(int n, double *x, double *y);         // 2D polygon
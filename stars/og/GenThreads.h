@@ -0,0 +1,138 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_GEN_THREADS_H__
+#define __GEODA_CENTER_GEN_THREADS_H__
+
+#include <vector>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+/**
+ GenThread
+ Worker thread for the weights builders.  Same shape as MyThread in
+ core/mt_densitymap.h: subclasses override run().
+ */
+class GenThread
+{
+public:
+	GenThread() : started(false) {}
+	virtual ~GenThread() {}
+
+	/** returns true if thread was started successfully */
+	bool start() {
+		started = (pthread_create(&thread, NULL, startEntry, this) == 0);
+		return started;
+	}
+	/** will not return until thread has exited */
+	void join() {
+		if (started) pthread_join(thread, NULL);
+		started = false;
+	}
+
+protected:
+	/** real run function that should be overwritten */
+	virtual void run() = 0;
+
+private:
+	pthread_t thread;
+	bool started;
+	static void* startEntry(void* This) {
+		((GenThread*)This)->run();
+		return NULL;
+	}
+	friend void GenThreadsRunInline(GenThread* t);
+};
+
+inline void GenThreadsRunInline(GenThread* t) { t->run(); }
+
+/**
+ GenMutex
+ pthread mutex; GenMutex::Lock holds it for the lifetime of the lock.
+ */
+class GenMutex
+{
+public:
+	GenMutex() { pthread_mutex_init(&mutex, NULL); }
+	~GenMutex() { pthread_mutex_destroy(&mutex); }
+	void lock() { pthread_mutex_lock(&mutex); }
+	void unlock() { pthread_mutex_unlock(&mutex); }
+
+	class Lock {
+	public:
+		Lock(GenMutex& m) : m(m) { m.lock(); }
+		~Lock() { m.unlock(); }
+	private:
+		GenMutex& m;
+	};
+
+private:
+	pthread_mutex_t mutex;
+	GenMutex(const GenMutex&);
+	GenMutex& operator=(const GenMutex&);
+};
+
+namespace GenThreads {
+	/** number of processors online, at least 1 */
+	inline int NumThreads() {
+#ifdef _WIN32
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		int n = (int) info.dwNumberOfProcessors;
+#else
+		int n = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+		return n > 0 ? n : 1;
+	}
+
+	/** thread count to use for n work items: requested (or all
+	 processors when nthreads <= 0), never more than the items */
+	inline int NumThreads(long n, int nthreads) {
+		if (nthreads <= 0) nthreads = NumThreads();
+		if (n < nthreads) nthreads = (int) n;
+		return nthreads > 0 ? nthreads : 1;
+	}
+
+	/** first item of block t when [0,n) is split into nt contiguous blocks */
+	inline long BlockBegin(long n, int t, int nt) {
+		return (long) (((long double) n * t) / nt);
+	}
+
+	/** runs every worker and waits for all of them.  The last worker, and
+	 any worker whose thread cannot be created, runs on the calling thread */
+	inline void RunAll(const std::vector<GenThread*>& workers) {
+		std::vector<bool> started(workers.size(), false);
+		size_t i;
+		for (i=0; i<workers.size(); i++) {
+			if (i+1 < workers.size()) started[i] = workers[i]->start();
+		}
+		for (i=0; i<workers.size(); i++) {
+			if (!started[i]) GenThreadsRunInline(workers[i]);
+		}
+		for (i=0; i<workers.size(); i++) {
+			if (started[i]) workers[i]->join();
+		}
+	}
+}
+
+#endif
@@ -1,7 +1,22 @@
+#include <algorithm>
+#include <math.h>
+#include <sstream>
+#include <stdexcept>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "ShapeOperations/shp2cnt.h"
 #include "ShapeOperations/shp2gwt.h"
+#include "ShapeOperations/SpaceTimeWeights.h"
+#include "ShapeOperations/DelaunayWeights.h"
+#include "ShapeOperations/KernelWeights.h"
+#include "ShapeOperations/ThresholdWeights.h"
+#include "ShapeOperations/DynamicKnn.h"
+#include "ShapeOperations/WeightsWriter.h"
 
 bool OGIsLineShapeFile(char* fname)
 {
@@ -24,7 +39,61 @@ double OGComputeMaxDistance(std::vector<double>& x,
 }
 
 /**
- *
+ * Distances of every observation to its k-th nearest neighbor, from one
+ * parallel kNN pass, for suggesting distance bands:
+ * [min, max, mean, 10%, 25%, 50%, 75% and 90% quantiles, extent,
+ *  counts of a histogram of bins equal bins over [min, max]].
+ * A band of max leaves no observation with fewer than k neighbors (no
+ * islands for k = 1); extent is OGComputeMaxDistance.  Empty when k is
+ * not in 1 .. x.size()-1.  index_fname: see OGCreateGwt.
+ */
+std::vector<double> OGComputeKnnDistances(std::vector<double>& x,
+										  std::vector<double>& y,
+										  int k,
+										  int method,
+										  int bins,
+										  char* index_fname)
+{
+	std::vector<double> summary, dist;
+	if (!KthNeighborDistances(x, y, k, method, dist, 0, index_fname))
+		return summary;
+	std::sort(dist.begin(), dist.end());
+	const long n = (long) dist.size();
+	const double lo = dist[0], hi = dist[n-1];
+	double sum = 0;
+	for (long i= 0; i < n; i++) sum += dist[i];
+	summary.push_back(lo);
+	summary.push_back(hi);
+	summary.push_back(sum / n);
+	const double probs[] = { 0.1, 0.25, 0.5, 0.75, 0.9 };
+	for (int q= 0; q < 5; q++) {
+		// linear between the order statistics around p (n-1)
+		double pos = probs[q] * (n-1);
+		long at = (long) floor(pos);
+		double frac = pos - at;
+		summary.push_back(at+1 < n ?
+						  dist[at] + frac * (dist[at+1] - dist[at]) : dist[at]);
+	}
+	summary.push_back(ComputeMaxDistance(x, y, method));
+	if (bins < 1) bins = 1;
+	std::vector<double> hist(bins, 0);
+	for (long i= 0; i < n; i++) {
+		int b = hi > lo ? (int) ((dist[i] - lo) / (hi - lo) * bins) : 0;
+		hist[b < bins ? b : bins-1] += 1;
+	}
+	summary.insert(summary.end(), hist.begin(), hist.end());
+	return summary;
+}
+
+/**
+ * Rook or queen contiguity, of order ooC.  engine 1 finds the neighbors
+ * from shared vertices and edges, with the vertices snapped to a grid of
+ * cell size tolerance, instead of the polygon sweep (engine 0).
+ * binary 1 writes a binary .galb file (see WeightsWriter), read only by
+ * the C++ weights readers.  When shpname cannot be read, or its
+ * contiguity cannot be built, or a binary galname does not end with
+ * .galb, std::runtime_error carries the reason (RuntimeError in Python);
+ * false means the file could not be written.
  */
 bool OGCreateGal(char* shpname,
                  char* galname,
@@ -32,30 +101,40 @@ bool OGCreateGal(char* shpname,
                  std::vector<int>& id_vec,
                  int is_rook,
                  int ooC,
-                 int is_include_lower
+                 int is_include_lower,
+                 int engine,
+                 double tolerance,
+                 int binary
                  )
 {
 	int num_obs = (int)(id_vec.size());	
+	if (binary && !WeightsWriter::HasExt(galname, WeightsWriter::GalExt))
+		throw std::runtime_error("binary weights files are named *.galb");
 	
-	// create gal
-    GalElement* gal = shp2gal(shpname, (is_rook? 1:0),true);
-	GalElement* Hgal = 0;
+	// create gal; the neighbor lists live in arena
+	WeightsArena arena;
+	ContiguityBuilder builder;
+	if (!builder.Open(shpname)) throw std::runtime_error(builder.Error());
+    GalElement* gal = engine == ContiguityBuilder::hash
+		? builder.GalHash((is_rook? 1:0), tolerance, &arena)
+		: builder.Gal((is_rook? 1:0), &arena);
     
     if (!gal)
-        return false;
+        throw std::runtime_error(builder.Error());
 		
 	bool flag = false;
 	
     if (ooC > 1)
 	{
-        Hgal = HOContiguity(ooC, num_obs, gal, is_include_lower);
-	    flag = SaveGal(Hgal, galname, id, id_vec);
+		GalCsr Hgal;
+		if (HOContiguity(ooC, num_obs, gal, is_include_lower, Hgal))
+			flag = binary ? SaveGalBinary(Hgal, galname, id, id_vec)
+				: SaveGal(Hgal, galname, id, id_vec);
 	}
 	else
-	    flag = SaveGal(gal, galname, id, id_vec);
+	    flag = binary ? SaveGalBinary(gal, galname, id, id_vec)
+			: SaveGal(gal, galname, id, id_vec);
 
-	if (Hgal)
-		delete[] Hgal;
 	delete[] gal;
 		
 	//delete &id_vec;
@@ -65,7 +144,19 @@ bool OGCreateGal(char* shpname,
 
 
 /**
- *
+ * Distance band (threshold > 0, k == 0) or k nearest neighbor
+ * (threshold == 0, k > 0) weights.
+ * With kernel >= 0 (KernelType) the weights are kernel weights instead:
+ * adaptive bandwidths from the k-th nearest neighbor, or a fixed
+ * bandwidth (the largest k-th nearest neighbor distance when bandwidth
+ * is 0).  diagonal 1 sets the weight of each observation on itself to 1
+ * rather than K(0).  index_fname, when given, caches the kd-tree of
+ * Euclidean (method 1) nearest neighbor searches: a tree saved there for
+ * the same x and y is memory-mapped instead of rebuilt.  binary 1 writes
+ * a binary .gwtb file (see WeightsWriter), read only by the C++ weights
+ * readers; std::runtime_error when gwtname does not end with .gwtb then.
+ * max_nbrs > 0 caps distance band rows at the max_nbrs nearest mutual
+ * neighbors (see ThresholdGwt); rows are not capped by default.
  */
 bool OGCreateGwt(char* gwtname,
                  char* id,
@@ -74,17 +165,38 @@ bool OGCreateGwt(char* gwtname,
 				 std::vector<double>& y,
 				 double threshold,
 				 int k,
-				 int method)
+				 int method,
+				 int kernel,
+				 double bandwidth,
+				 int adaptive,
+				 int diagonal,
+				 char* index_fname,
+				 int binary,
+				 int max_nbrs)
 {
-	int num_obs = (int)(x.size());
-	// create gwt
+	if (binary && !WeightsWriter::HasExt(gwtname, WeightsWriter::GwtExt))
+		throw std::runtime_error("binary weights files are named *.gwtb");
+
+	// create gwt; the neighbor lists live in arena
 	GwtElement* gwt = 0;
+	WeightsArena arena;
 	int degree = 1;
 		
-	if (threshold > 0 && k ==0)
-		gwt = shp2gwt(num_obs, x, y, threshold, degree, method);
+	if (kernel >= 0) {
+		gwt = KernelGwt(x, y, kernel, k, bandwidth, adaptive != 0, diagonal,
+						method, 0, &arena);
+		if (gwt == 0)
+			return false;
+		bool flag = binary ? WriteGwtBinary(gwt, gwtname, id, id_vec)
+			: WriteGwt(gwt, gwtname, id, id_vec, 1, true);
+		delete[] gwt;
+		return flag;
+	}
+	else if (threshold > 0 && k == 0)
+		gwt = ThresholdGwt(x, y, threshold, degree, method, max_nbrs, 0,
+						   &arena);
 	else if (threshold == .0 && k > 0)
-		gwt = DynKNN(x, y, k+1, method);	
+		gwt = AllKNN(x, y, k, method, 0, &arena, index_fname);
 	else
 		return false;
 	
@@ -95,7 +207,9 @@ bool OGCreateGwt(char* gwtname,
 	bool geodaL = true; // geoda legacy format
 	bool flag = false;
 
-	if (threshold > 0 && k ==0)
+	if (binary)
+		flag = WriteGwtBinary(gwt, gwtname, id, id_vec);
+	else if (threshold > 0 && k == 0)
 		flag = WriteGwt(gwt, gwtname, id, id_vec, 1, geodaL);
 	else if (threshold == .0 && k > 0)
 		flag = WriteGwt(gwt, gwtname, id, id_vec, -2, geodaL);
@@ -108,4 +222,290 @@ bool OGCreateGwt(char* gwtname,
 	return flag;
 }
 				 
-				 
\ No newline at end of file
+				 
+
+/**
+ * Space-time contiguity over id_vec.size() units and n_periods periods.
+ * The temporal neighbors are read from time_galname or, when it is empty,
+ * are the n_past preceding and n_future following periods; it must have
+ * n_periods observations, and shpname id_vec.size() records.  Nodes are
+ * written in record order (header "0 nT", no key variable): unit i in
+ * period t is t*n + i.  binary 1 writes a binary .galb file as in
+ * OGCreateGal.  Contiguity failures throw as in OGCreateGal.
+ */
+bool OGCreateSpaceTimeGal(char* shpname,
+                          char* galname,
+                          std::vector<int>& id_vec,
+                          int is_rook,
+                          char* time_galname,
+                          int n_periods,
+                          int n_past,
+                          int n_future,
+                          int st_type,
+                          int binary)
+{
+	long num_obs = (long)(id_vec.size());
+	if (num_obs < 1 || n_periods < 1) return false;
+	if (binary && !WeightsWriter::HasExt(galname, WeightsWriter::GalExt))
+		throw std::runtime_error("binary weights files are named *.galb");
+
+	ContiguityBuilder builder;
+	if (!builder.Open(shpname)) throw std::runtime_error(builder.Error());
+	if (builder.NumObs() != num_obs) return false;
+	WeightsArena arena;
+	GalElement* gal = builder.Gal((is_rook? 1:0), &arena);
+	if (!gal) throw std::runtime_error(builder.Error());
+
+	GalElement* tgal = 0;
+	long t_obs = n_periods;
+	if (time_galname && time_galname[0])
+		tgal = WeightUtils::ReadGal(time_galname, &t_obs);
+	else
+		tgal = TimeLagGal(n_periods, n_past, n_future);
+
+	bool flag = false;
+	GalCsr stgal;
+	if (tgal && t_obs == n_periods &&
+		SpaceTimeContiguity(gal, num_obs, tgal, n_periods, st_type, stgal)) {
+		std::vector<int> st_ids(num_obs * n_periods);
+		for (size_t i=0; i<st_ids.size(); i++) st_ids[i] = (int) i;
+		flag = binary ? SaveGalBinary(stgal, galname, "", st_ids)
+			: SaveGal(stgal, galname, "", st_ids);
+	}
+
+	if (tgal) delete[] tgal;
+	delete[] gal;
+	return flag;
+}
+
+
+/**
+ * Point contiguity from the Delaunay triangulation of (x, y).
+ * graph_type: 0 Delaunay, 1 Gabriel, 2 sphere of influence
+ */
+bool OGCreateDelaunayGal(char* galname,
+                         char* id,
+                         std::vector<int>& id_vec,
+                         std::vector<double>& x,
+                         std::vector<double>& y,
+                         int graph_type)
+{
+	if (x.size() != id_vec.size()) return false;
+	GalCsr gal;
+	if (!DelaunayContiguity(x, y, graph_type, gal)) return false;
+	return SaveGal(gal, galname, id, id_vec);
+}
+
+
+/**
+ * Contiguity weighted by shared boundary length, or with perimeter_share
+ * by that length over the perimeter of the row polygon.  Contiguity
+ * failures throw as in OGCreateGal.
+ */
+bool OGCreateBoundaryGwt(char* shpname,
+                         char* gwtname,
+                         char* id,
+                         std::vector<int>& id_vec,
+                         int is_rook,
+                         int perimeter_share)
+{
+	WeightsArena arena;
+	ContiguityBuilder builder;
+	if (!builder.Open(shpname)) throw std::runtime_error(builder.Error());
+	GwtElement* gwt = builder.BoundaryLength((is_rook? 1:0),
+											 perimeter_share != 0, &arena);
+	if (!gwt) throw std::runtime_error(builder.Error());
+	bool flag = WriteGwt(gwt, gwtname, id, id_vec, 1, true);
+	delete[] gwt;
+	return flag;
+}
+
+
+/*
+ IdRecords
+ The record of each id: a table over the range of the ids when they are
+ dense, as they usually are, a binary search otherwise.
+ */
+class IdRecords {
+public:
+	/** false when an id is repeated */
+	bool Init(const std::vector<int>& ids, const long n) {
+		sorted.resize(n);
+		for (long i= 0; i < n; i++) sorted[i] = std::make_pair(ids[i], i);
+		std::sort(sorted.begin(), sorted.end());
+		for (long i= 1; i < n; i++)
+			if (sorted[i].first == sorted[i-1].first) return false;
+		low = n > 0 ? sorted[0].first : 0;
+		if (n > 0 && (double) sorted[n-1].first - low < 4.0 * n) {
+			table.assign(sorted[n-1].first - low + 1, -1);
+			for (long i= 0; i < n; i++)
+				table[sorted[i].first - low] = sorted[i].second;
+		}
+		return true; }
+	/** -1 when there is no such id */
+	long Find(const long id) const {
+		if (!table.empty()) {
+			return id >= low && id - low < (long) table.size() ?
+				table[id - low] : -1;
+		}
+		std::vector<std::pair<int, long> >::const_iterator it =
+			std::lower_bound(sorted.begin(), sorted.end(),
+							 std::make_pair((int) id, 0L));
+		return it != sorted.end() && it->first == id ? it->second : -1; }
+private:
+	std::vector<std::pair<int, long> > sorted;
+	std::vector<long> table;
+	long low;
+};
+
+/* the .gwt lines of row i, as WriteGwt writes them */
+static void PutKnnRow(WeightsWriter& out, const DynamicKnn& knn,
+					  const long i, const std::vector<int>& id_vec)
+{
+	for (int j= 0; j < knn.RowSize(i); j++) {
+		out.PutInt(id_vec[i]);
+		out.Put(' ');
+		out.PutInt(id_vec[knn.Neighbor(i, j)]);
+		out.Put(' ');
+		out.PutWeight(knn.Distance(i, j));
+		out.Put('\n');
+	}
+}
+
+/**
+ * Appends points to the k nearest neighbor weights in the text .gwt file
+ * gwtname, as written by OGCreateGwt (threshold 0, Euclidean).  x, y and
+ * id_vec hold all the points: the first n_old are those in gwtname, the
+ * others are new.  The rows of the new points and the rows that gained
+ * one of them are written afresh, every other line is copied as it is,
+ * and only the neighborhoods of the new points are searched (see
+ * DynamicKnn), so the search cost grows with the number of new points;
+ * the file itself is still read and written once.
+ * The rows in gwtname are taken to be the k nearest neighbors of the old
+ * points; false, with gwtname unchanged, when it does not hold k
+ * neighbors of each of them (rebuild it with OGCreateGwt then).
+ */
+bool OGAppendKnnGwt(char* gwtname,
+					std::vector<int>& id_vec,
+					std::vector<double>& x,
+					std::vector<double>& y,
+					int k,
+					int n_old)
+{
+	const long n = (long) id_vec.size();
+	if (k < 1 || n_old < 1 || n_old > n || (long) x.size() != n ||
+		(long) y.size() != n) return false;
+	IdRecords rec;  // record of each old id
+	if (!rec.Init(id_vec, n_old)) return false;
+	long i;
+
+	std::vector<char> text;
+	{
+		FILE* f = fopen(gwtname, "rb");
+		if (!f) return false;
+		char chunk[1 << 16];
+		size_t got;
+		while ((got = fread(chunk, 1, sizeof chunk, f)) > 0)
+			text.insert(text.end(), chunk, chunk + got);
+		fclose(f);
+	}
+	if (text.empty() || text.back() != '\n') text.push_back('\n');
+	text.push_back(0);  // strtol stops here
+	const char* const first = &text[0];
+	const char* const last = first + text.size() - 1;
+	const char* body = (const char*) memchr(first, '\n', last - first) + 1;
+	const std::string header(first, body - 1);
+	std::vector<long> origin;  // row of each line
+	std::vector<long> old_nbrs((size_t) n_old * k);
+	std::vector<int> old_cnt(n_old, 0);
+	bool ok = true;
+	long ra = -1, prev_a = 0;
+	for (const char* p = body; ok && p < last; ) {
+		const char* eol = (const char*) memchr(p, '\n', last - p);
+		char* end;
+		const long a = strtol(p, &end, 10);
+		const long b = strtol(end, &end, 10);
+		if (end == p || end > eol) {
+			origin.push_back(-1);  // a blank line
+		} else {
+			// the lines of a row are usually together
+			if (ra < 0 || a != prev_a) ra = rec.Find(a);
+			prev_a = a;
+			const long rb = rec.Find(b);
+			ok = ra >= 0 && rb >= 0 && old_cnt[ra] < k;
+			if (ok) {
+				origin.push_back(ra);
+				old_nbrs[(size_t) ra * k + old_cnt[ra]++] = rb;
+			}
+		}
+		p = eol + 1;
+	}
+	if (!ok) return false;
+
+	// the old rows, then the new points
+	DynamicKnn knn(k);
+	{
+		GwtElement* old_rows = new GwtElement[n_old];
+		for (i= 0; i < n_old; i++) {
+			old_rows[i].alloc(old_cnt[i]);
+			for (int j= 0; j < old_cnt[i]; j++)
+				old_rows[i].Push(GwtNeighbor(old_nbrs[(size_t) i * k + j]));
+		}
+		std::vector<double> xo(x.begin(), x.begin() + n_old);
+		std::vector<double> yo(y.begin(), y.begin() + n_old);
+		ok = knn.Init(xo, yo, old_rows);
+		delete [] old_rows;
+	}
+	if (!ok) return false;
+	std::vector<long> changed;
+	std::vector<double> xn(x.begin() + n_old, x.end());
+	std::vector<double> yn(y.begin() + n_old, y.end());
+	knn.Insert(xn, yn, changed);
+	std::vector<char> redo(n, 0);
+	for (size_t c= 0; c < changed.size(); c++) redo[changed[c]] = 1;
+
+	// the header with the new number of observations, the old lines or
+	// the changed rows in their place, and the new rows
+	const std::string tmp = std::string(gwtname) + ".tmp";
+	{
+		std::istringstream hs(header);
+		std::string flag, count, rest;
+		hs >> flag >> count;
+		std::getline(hs, rest);
+		if (count.empty()) return false;
+		WeightsWriter out(tmp.c_str());
+		if (!out.IsOpen()) return false;
+		out.Put(flag.c_str());
+		out.Put(' ');
+		out.PutInt(n);
+		out.Put(rest.c_str());
+		out.Put('\n');
+		// unchanged lines are copied in runs
+		const char* run = body;
+		const char* p = body;
+		for (size_t l= 0; l < origin.size(); l++) {
+			const char* next = (const char*) memchr(p, '\n', last - p) + 1;
+			const long a = origin[l];
+			if (a >= 0 && redo[a]) {
+				out.Write(run, p - run);
+				if (redo[a] == 1) PutKnnRow(out, knn, a, id_vec);
+				redo[a] = 2;  // written
+				run = next;
+			}
+			p = next;
+		}
+		out.Write(run, p - run);
+		for (i= 0; i < n_old; i++) {
+			// rows that had no lines, when there was a single point
+			if (redo[i] == 1) PutKnnRow(out, knn, i, id_vec);
+		}
+		for (i= n_old; i < n; i++) PutKnnRow(out, knn, i, id_vec);
+		ok = out.Close();
+	}
+	if (ok && rename(tmp.c_str(), gwtname) != 0) {
+		// Windows does not rename over an existing file
+		ok = remove(gwtname) == 0 && rename(tmp.c_str(), gwtname) == 0;
+	}
+	if (!ok) remove(tmp.c_str());
+	return ok;
+}
@@ -8,7 +8,10 @@ bool OGCreateGal(char* shpname,
                  std::vector<int>& id_vec,
                  int is_rook,
                  int ooC,
-                 int is_include_lower);
+                 int is_include_lower,
+                 int engine = 0,
+                 double tolerance = 0,
+                 int binary = 0);
                  
 bool OGCreateGwt(char* gwtname,
                  char* id,
@@ -17,7 +20,14 @@ bool OGCreateGwt(char* gwtname,
 				 std::vector<double>& y,
 				 double threshold,
 				 int k,
-				 int method);
+				 int method,
+				 int kernel = -1,
+				 double bandwidth = 0,
+				 int adaptive = 0,
+				 int diagonal = 0,
+				 char* index_fname = 0,
+				 int binary = 0,
+				 int max_nbrs = 0);
 
 double OGComputeCutOffPoint(std::vector<double>& x,
 				            std::vector<double>& y,
@@ -26,3 +36,42 @@ double OGComputeCutOffPoint(std::vector<double>& x,
 double OGComputeMaxDistance(std::vector<double>& x,
 				            std::vector<double>& y,
 							int method);
+
+std::vector<double> OGComputeKnnDistances(std::vector<double>& x,
+										  std::vector<double>& y,
+										  int k,
+										  int method,
+										  int bins = 10,
+										  char* index_fname = 0);
+
+bool OGCreateSpaceTimeGal(char* shpname,
+                          char* galname,
+                          std::vector<int>& id_vec,
+                          int is_rook,
+                          char* time_galname,
+                          int n_periods,
+                          int n_past,
+                          int n_future,
+                          int st_type,
+                          int binary = 0);
+
+bool OGCreateDelaunayGal(char* galname,
+                         char* id,
+                         std::vector<int>& id_vec,
+                         std::vector<double>& x,
+                         std::vector<double>& y,
+                         int graph_type);
+
+bool OGCreateBoundaryGwt(char* shpname,
+                         char* gwtname,
+                         char* id,
+                         std::vector<int>& id_vec,
+                         int is_rook,
+                         int perimeter_share);
+
+bool OGAppendKnnGwt(char* gwtname,
+                    std::vector<int>& id_vec,
+                    std::vector<double>& x,
+                    std::vector<double>& y,
+                    int k,
+                    int n_old);
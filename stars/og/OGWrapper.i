@@ -1,5 +1,8 @@
 %module OGWrapper
 
+// default arguments are optional Python arguments of a single wrapper
+%feature("compactdefaultargs");
+
 %{
 #include "OGWrapper.h"
 %}
@@ -16,6 +19,15 @@ namespace std {
 
 #include <vector>
 
+// C++ exceptions from the weights code become Python RuntimeErrors
+%exception {
+  try {
+    $action
+  } catch (std::exception& e) {
+    SWIG_exception(SWIG_RuntimeError, e.what());
+  }
+}
+
 bool OGIsLineShapeFile(char* fname);
 
 bool OGCreateGal(char* shpname,
@@ -24,7 +36,10 @@ bool OGCreateGal(char* shpname,
                  std::vector<int>& id_vec,
 				 int is_rook,
 				 int ooC,
-				 int is_include_lower);
+				 int is_include_lower,
+				 int engine = 0,
+				 double tolerance = 0,
+				 int binary = 0);
 
 bool OGCreateGwt(char* gwtname,
                  char* id,
@@ -33,7 +48,14 @@ bool OGCreateGwt(char* gwtname,
 				 std::vector<double>& y,
 				 double threshold,
 				 int k,
-				 int method);
+				 int method,
+				 int kernel = -1,
+				 double bandwidth = 0,
+				 int adaptive = 0,
+				 int diagonal = 0,
+				 char* index_fname = 0,
+				 int binary = 0,
+				 int max_nbrs = 0);
 
 double OGComputeCutOffPoint(std::vector<double>& x,
 				            std::vector<double>& y,
@@ -41,4 +63,43 @@ double OGComputeCutOffPoint(std::vector<double>& x,
 							
 double OGComputeMaxDistance(std::vector<double>& x,
 				            std::vector<double>& y,
-							int method);
\ No newline at end of file
+							int method);
+
+std::vector<double> OGComputeKnnDistances(std::vector<double>& x,
+										  std::vector<double>& y,
+										  int k,
+										  int method,
+										  int bins = 10,
+										  char* index_fname = 0);
+
+bool OGCreateSpaceTimeGal(char* shpname,
+                          char* galname,
+                          std::vector<int>& id_vec,
+                          int is_rook,
+                          char* time_galname,
+                          int n_periods,
+                          int n_past,
+                          int n_future,
+                          int st_type,
+                          int binary = 0);
+
+bool OGCreateDelaunayGal(char* galname,
+                         char* id,
+                         std::vector<int>& id_vec,
+                         std::vector<double>& x,
+                         std::vector<double>& y,
+                         int graph_type);
+
+bool OGCreateBoundaryGwt(char* shpname,
+                         char* gwtname,
+                         char* id,
+                         std::vector<int>& id_vec,
+                         int is_rook,
+                         int perimeter_share);
+
+bool OGAppendKnnGwt(char* gwtname,
+                    std::vector<int>& id_vec,
+                    std::vector<double>& x,
+                    std::vector<double>& y,
+                    int k,
+                    int n_old);
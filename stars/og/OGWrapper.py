@@ -357,5 +357,10 @@ OGCreateGal = _OGWrapper.OGCreateGal
 OGCreateGwt = _OGWrapper.OGCreateGwt
 OGComputeCutOffPoint = _OGWrapper.OGComputeCutOffPoint
 OGComputeMaxDistance = _OGWrapper.OGComputeMaxDistance
+OGComputeKnnDistances = _OGWrapper.OGComputeKnnDistances
+OGCreateSpaceTimeGal = _OGWrapper.OGCreateSpaceTimeGal
+OGCreateDelaunayGal = _OGWrapper.OGCreateDelaunayGal
+OGCreateBoundaryGwt = _OGWrapper.OGCreateBoundaryGwt
+OGAppendKnnGwt = _OGWrapper.OGAppendKnnGwt
 
 
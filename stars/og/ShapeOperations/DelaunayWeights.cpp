@@ -0,0 +1,304 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "DelaunayWeights.h"
+
+/* sorts observations by (x, y) */
+struct PointOrder {
+	const std::vector<double>& x;
+	const std::vector<double>& y;
+	PointOrder(const std::vector<double>& x_, const std::vector<double>& y_)
+	: x(x_), y(y_) {}
+	bool operator()(const long a, const long b) const {
+		return x[a] < x[b] || (x[a] == x[b] && y[a] < y[b]); }
+};
+
+// predicates are evaluated relative to one of the points, which keeps
+// them exact on grids and close to it for projected coordinates
+bool Delaunay::CCW(int a, int b, int c) const
+{
+	long double ax = px[a]-px[c], ay = py[a]-py[c];
+	long double bx = px[b]-px[c], by = py[b]-py[c];
+	return ax * by - ay * bx > 0;
+}
+
+/* d lies strictly inside the circle through a, b, c (counterclockwise) */
+bool Delaunay::InCircle(int a, int b, int c, int d) const
+{
+	long double adx = px[a]-px[d], ady = py[a]-py[d];
+	long double bdx = px[b]-px[d], bdy = py[b]-py[d];
+	long double cdx = px[c]-px[d], cdy = py[c]-py[d];
+	long double det = (adx*adx + ady*ady) * (bdx*cdy - cdx*bdy)
+		+ (bdx*bdx + bdy*bdy) * (cdx*ady - adx*cdy)
+		+ (cdx*cdx + cdy*cdy) * (adx*bdy - bdx*ady);
+	return det > 0;
+}
+
+int Delaunay::MakeEdge(int a, int b)
+{
+	int e;
+	if (!free_quads.empty()) {
+		e = free_quads.back();
+		free_quads.pop_back();
+	} else {
+		e = (int) next.size();
+		next.resize(e + 4);
+		org.resize((e + 4) >> 1);
+	}
+	next[e] = e;
+	next[e+1] = e+3;
+	next[e+2] = e+2;
+	next[e+3] = e+1;
+	org[e >> 1] = a;
+	org[(e+2) >> 1] = b;
+	return e;
+}
+
+void Delaunay::Splice(int a, int b)
+{
+	int alpha = Rot(next[a]), beta = Rot(next[b]);
+	std::swap(next[a], next[b]);
+	std::swap(next[alpha], next[beta]);
+}
+
+/* new edge from Dest(a) to Org(b), with a, the new edge and b sharing
+ their left face */
+int Delaunay::Connect(int a, int b)
+{
+	int e = MakeEdge(Dest(a), Org(b));
+	Splice(e, Lnext(a));
+	Splice(Sym(e), b);
+	return e;
+}
+
+void Delaunay::DeleteEdge(int e)
+{
+	Splice(e, Oprev(e));
+	Splice(Sym(e), Oprev(Sym(e)));
+	e &= ~3;
+	org[e >> 1] = -1;
+	free_quads.push_back(e);
+}
+
+/* triangulates the points [lo, hi), hi-lo >= 2.  le is the
+ counterclockwise convex hull edge out of the leftmost point, re the
+ clockwise hull edge out of the rightmost point. */
+void Delaunay::Build(long lo, long hi, int& le, int& re)
+{
+	long n = hi - lo;
+	int s0 = (int) lo, s1 = (int) lo + 1;
+	if (n == 2) {
+		le = MakeEdge(s0, s1);
+		re = Sym(le);
+		return;
+	}
+	if (n == 3) {
+		int s2 = (int) lo + 2;
+		int a = MakeEdge(s0, s1), b = MakeEdge(s1, s2);
+		Splice(Sym(a), b);
+		if (CCW(s0, s1, s2)) {
+			Connect(b, a);
+			le = a;
+			re = Sym(b);
+		} else if (CCW(s0, s2, s1)) {
+			int c = Connect(b, a);
+			le = Sym(c);
+			re = c;
+		} else { // collinear
+			le = a;
+			re = Sym(b);
+		}
+		return;
+	}
+
+	int ldo, ldi, rdi, rdo;
+	Build(lo, lo + n/2, ldo, ldi);
+	Build(lo + n/2, hi, rdi, rdo);
+
+	// lower common tangent of the two halves
+	for (;;) {
+		if (LeftOf(Org(rdi), ldi)) ldi = Lnext(ldi);
+		else if (RightOf(Org(ldi), rdi)) rdi = Rprev(rdi);
+		else break;
+	}
+	int basel = Connect(Sym(rdi), ldi);
+	if (Org(ldi) == Org(ldo)) ldo = Sym(basel);
+	if (Org(rdi) == Org(rdo)) rdo = basel;
+
+	// zip the halves together from the bottom up
+	for (;;) {
+		int lcand = Onext(Sym(basel));
+		bool lvalid = RightOf(Dest(lcand), basel);
+		if (lvalid) {
+			while (InCircle(Dest(basel), Org(basel), Dest(lcand),
+							Dest(Onext(lcand)))) {
+				int t = Onext(lcand);
+				DeleteEdge(lcand);
+				lcand = t;
+			}
+		}
+		int rcand = Oprev(basel);
+		bool rvalid = RightOf(Dest(rcand), basel);
+		if (rvalid) {
+			while (InCircle(Dest(basel), Org(basel), Dest(rcand),
+							Dest(Oprev(rcand)))) {
+				int t = Oprev(rcand);
+				DeleteEdge(rcand);
+				rcand = t;
+			}
+		}
+		if (!lvalid && !rvalid) break;
+		if (!lvalid || (rvalid && InCircle(Dest(lcand), Org(lcand),
+										   Org(rcand), Dest(rcand))))
+			basel = Connect(rcand, Sym(basel));
+		else
+			basel = Connect(Sym(basel), Sym(lcand));
+	}
+	le = ldo;
+	re = rdo;
+}
+
+bool Delaunay::Triangulate(const std::vector<double>& x,
+						   const std::vector<double>& y)
+{
+	long obs = (long) x.size(), i;
+	px.clear(); py.clear(); loc.clear();
+	next.clear(); org.clear(); free_quads.clear();
+	if (obs < 1 || x.size() != y.size()) return false;
+
+	std::vector<long> idx(obs);
+	for (i= 0; i < obs; ++i) idx[i] = i;
+	std::sort(idx.begin(), idx.end(), PointOrder(x, y));
+	loc.resize(obs);
+	px.reserve(obs);
+	py.reserve(obs);
+	for (i= 0; i < obs; ++i) {
+		long o = idx[i];
+		if (px.empty() || x[o] != px.back() || y[o] != py.back()) {
+			px.push_back(x[o]);
+			py.push_back(y[o]);
+		}
+		loc[o] = (long) px.size() - 1;
+	}
+	long n = NumPoints();
+	if (n > (1L << 28)) return false; // quad-edge ids are ints
+	next.reserve(12 * n);
+	org.reserve(6 * n);
+	if (n >= 2) {
+		int le, re;
+		Build(0, n, le, re);
+	}
+	return true;
+}
+
+void Delaunay::Edges(int type,
+					 std::vector< std::pair<long, long> >& edges) const
+{
+	edges.clear();
+	long n = NumPoints();
+	std::vector<double> r;
+	if (type == DelaunayWeights::soi) {
+		r.assign(n, -1);
+		for (int e= 0; e < (int) next.size(); e += 4) {
+			int a = Org(e), b = Dest(e);
+			if (a < 0) continue;
+			double d = sqrt((px[a]-px[b])*(px[a]-px[b]) +
+							(py[a]-py[b])*(py[a]-py[b]));
+			if (r[a] < 0 || d < r[a]) r[a] = d;
+			if (r[b] < 0 || d < r[b]) r[b] = d;
+		}
+	}
+	for (int e= 0; e < (int) next.size(); e += 4) {
+		int a = Org(e), b = Dest(e);
+		if (a < 0) continue;
+		if (type == DelaunayWeights::gabriel) {
+			// the apexes of the triangles on either side must see ab at
+			// an acute angle
+			bool keep = true;
+			for (int side= 0; side < 2 && keep; ++side) {
+				int s = side ? Sym(e) : e;
+				int c = Dest(Lnext(s));
+				if (!CCW(Org(s), Dest(s), c)) continue;
+				keep = (px[a]-px[c])*(px[b]-px[c]) +
+					(py[a]-py[c])*(py[b]-py[c]) > 0;
+			}
+			if (!keep) continue;
+		} else if (type == DelaunayWeights::soi) {
+			double d = sqrt((px[a]-px[b])*(px[a]-px[b]) +
+							(py[a]-py[b])*(py[a]-py[b]));
+			if (d > r[a] + r[b]) continue;
+		}
+		edges.push_back(a < b ? std::make_pair((long) a, (long) b)
+						: std::make_pair((long) b, (long) a));
+	}
+}
+
+bool DelaunayContiguity(const std::vector<double>& x,
+						const std::vector<double>& y,
+						int type, GalCsr& W)
+{
+	if (type < DelaunayWeights::delaunay || type > DelaunayWeights::soi)
+		return false;
+	Delaunay dt;
+	if (!dt.Triangulate(x, y)) return false;
+	long obs = (long) x.size(), n = dt.NumPoints(), i, j;
+	std::vector< std::pair<long, long> > edges;
+	dt.Edges(type, edges);
+
+	// observations at every location
+	std::vector<long> first(n + 1, 0), members(obs);
+	for (i= 0; i < obs; ++i) ++first[dt.Location(i) + 1];
+	for (i= 0; i < n; ++i) first[i+1] += first[i];
+	std::vector<long> pos(first.begin(), first.end() - 1);
+	for (i= 0; i < obs; ++i) members[pos[dt.Location(i)]++] = i;
+
+	// neighbor count of a location: its other members plus all members
+	// of the adjacent locations
+	std::vector<long> deg(n, 0);
+	for (size_t e= 0; e < edges.size(); ++e) {
+		long a = edges[e].first, b = edges[e].second;
+		deg[a] += first[b+1] - first[b];
+		deg[b] += first[a+1] - first[a];
+	}
+	W.offsets.assign(obs + 1, 0);
+	for (i= 0; i < obs; ++i) {
+		long l = dt.Location(i);
+		W.offsets[i+1] = W.offsets[i] + deg[l] + first[l+1] - first[l] - 1;
+	}
+	W.nbrs.resize(W.offsets[obs]);
+	std::vector<long> fill(W.offsets.begin(), W.offsets.end() - 1);
+	for (size_t e= 0; e < edges.size(); ++e) {
+		long a = edges[e].first, b = edges[e].second;
+		for (i= first[a]; i < first[a+1]; ++i)
+			for (j= first[b]; j < first[b+1]; ++j) {
+				W.nbrs[fill[members[i]]++] = members[j];
+				W.nbrs[fill[members[j]]++] = members[i];
+			}
+	}
+	for (long l= 0; l < n; ++l)
+		for (i= first[l]; i < first[l+1]; ++i)
+			for (j= first[l]; j < first[l+1]; ++j)
+				if (i != j) W.nbrs[fill[members[i]]++] = members[j];
+	for (i= 0; i < obs; ++i)
+		std::sort(W.nbrs.begin() + W.offsets[i],
+				  W.nbrs.begin() + W.offsets[i+1]);
+	return true;
+}
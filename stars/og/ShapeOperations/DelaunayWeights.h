@@ -0,0 +1,89 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_DELAUNAY_WEIGHTS_H__
+#define __GEODA_CENTER_DELAUNAY_WEIGHTS_H__
+
+#include <vector>
+#include <utility>
+#include "GalWeight.h"
+
+/*
+ Contiguity for point layers, derived from the Delaunay triangulation:
+ delaunay  -- i and j share a triangle edge
+ gabriel   -- Delaunay edges whose diametral circle holds no other point
+ soi       -- sphere of influence: Delaunay edges with d(i,j) <= r(i)+r(j),
+              r being the nearest neighbor distance
+ Coincident points are neighbors of each other and share the neighbors
+ of their location.
+ */
+namespace DelaunayWeights {
+	enum GraphType { delaunay = 0, gabriel = 1, soi = 2 };
+}
+
+/*
+ Delaunay
+ Divide and conquer triangulation (Guibas and Stolfi) on a quad-edge
+ structure; O(n log n) in the worst case.  Points are triangulated in
+ (x, y) order after removing duplicates.
+ */
+class Delaunay {
+public:
+	bool Triangulate(const std::vector<double>& x,
+					 const std::vector<double>& y);
+	/** distinct locations, and the location of every observation */
+	long NumPoints() const { return (long) px.size(); }
+	long Location(const long obs) const { return loc[obs]; }
+	/** undirected edges between locations, as (smaller, larger) pairs */
+	void Edges(int type, std::vector< std::pair<long, long> >& edges) const;
+
+private:
+	int MakeEdge(int a, int b);
+	void Splice(int a, int b);
+	int Connect(int a, int b);
+	void DeleteEdge(int e);
+	void Build(long lo, long hi, int& le, int& re);
+
+	static int Rot(int e) { return (e & ~3) | ((e + 1) & 3); }
+	static int Sym(int e) { return (e & ~3) | ((e + 2) & 3); }
+	static int InvRot(int e) { return (e & ~3) | ((e + 3) & 3); }
+	int Onext(int e) const { return next[e]; }
+	int Oprev(int e) const { return Rot(next[Rot(e)]); }
+	int Lnext(int e) const { return Rot(next[InvRot(e)]); }
+	int Rprev(int e) const { return next[Sym(e)]; }
+	int Org(int e) const { return org[e >> 1]; }
+	int Dest(int e) const { return org[Sym(e) >> 1]; }
+
+	bool CCW(int a, int b, int c) const;
+	bool InCircle(int a, int b, int c, int d) const;
+	bool RightOf(int p, int e) const { return CCW(p, Dest(e), Org(e)); }
+	bool LeftOf(int p, int e) const { return CCW(p, Org(e), Dest(e)); }
+
+	std::vector<double> px, py; // distinct points in (x, y) order
+	std::vector<long> loc;      // observation -> point
+	std::vector<int> next;      // Onext of every edge, 4 per quad-edge
+	std::vector<int> org;       // origin of the two primal edges of a quad
+	std::vector<int> free_quads;
+};
+
+bool DelaunayContiguity(const std::vector<double>& x,
+						const std::vector<double>& y,
+						int type, GalCsr& W);
+
+#endif
@@ -0,0 +1,332 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "shp2gwt.h"
+#include "DynamicKnn.h"
+
+// cell coordinates are kept within +-2^30, so keys fit in 64 bits
+static const double MaxCell = 1073741824.0;
+
+/* inserts b into the sorted row, which holds at most k entries; false
+ when b is not among the k nearest */
+bool DynamicKnn::Offer(Row& row, const Nbr& b, const int k)
+{
+	if ((int) row.size() < k) {
+		row.push_back(b);
+	} else if (b < row.back()) {
+		row.back() = b;
+	} else {
+		return false;
+	}
+	for (long j= (long) row.size() - 1; j > 0 && row[j] < row[j-1]; --j) {
+		std::swap(row[j], row[j-1]);
+	}
+	return true;
+}
+
+bool DynamicKnn::Init(const std::vector<double>& x,
+					  const std::vector<double>& y, int nthreads)
+{
+	if (x.size() != y.size()) return false;
+	if ((long) x.size() <= k) return Init(x, y, (const GwtElement*) 0);
+	GwtElement* gwt = AllKNN(x, y, k, 1, nthreads);
+	if (!gwt) return false;
+	bool ok = Init(x, y, gwt);
+	delete [] gwt;
+	return ok;
+}
+
+bool DynamicKnn::Init(const std::vector<double>& x,
+					  const std::vector<double>& y, const GwtElement* gwt)
+{
+	if (x.size() != y.size()) return false;
+	const long n = (long) x.size();
+	long i;
+	if (n <= k) gwt = NULL;
+	if (gwt) {
+		// k other points per row, each once
+		std::vector<long> stamp(n, -1);
+		for (i= 0; i < n; i++) {
+			if (gwt[i].Size() != k) return false;
+			for (long j= 0; j < k; j++) {
+				const long nb = gwt[i].elt(j).nbx;
+				if (nb < 0 || nb >= n || nb == i || stamp[nb] == i)
+					return false;
+				stamp[nb] = i;
+			}
+		}
+	}
+	xs = x;
+	ys = y;
+	alive.assign(n, 1);
+	rows.assign(n, Row());
+	live = n;
+	if (gwt) {
+		for (i= 0; i < n; i++) {
+			rows[i].resize(k);
+			for (long j= 0; j < k; j++) {
+				rows[i][j].id = gwt[i].elt(j).nbx;
+				rows[i][j].d2 = D2(i, rows[i][j].id);
+			}
+			std::sort(rows[i].begin(), rows[i].end());
+		}
+	}
+	Rebucket();
+	if (!gwt) {
+		// too few points for AllKNN: every row holds all the others
+		for (i= 0; i < n; i++) {
+			Search(xs[i], ys[i], i, rows[i]);
+			Classify(i);
+		}
+	}
+	return true;
+}
+
+long DynamicKnn::Insert(const double x, const double y,
+						std::vector<long>& changed)
+{
+	const long id = Ids();
+	xs.push_back(x);
+	ys.push_back(y);
+	alive.push_back(1);
+	rows.push_back(Row());
+	++live;
+	if (live >= rebucket_at) Rebucket(); else Add(id);
+	changed.clear();
+	changed.push_back(id);
+	Search(x, y, id, rows[id]);
+	Classify(id);
+
+	// the rows the new point can enter: near points in the 7 x 7 cells
+	// around it, and the wide points
+	std::vector<long> cand;
+	Nearby(x, y, 3, cand);
+	cand.insert(cand.end(), wide.begin(), wide.end());
+	std::sort(cand.begin(), cand.end());
+	cand.erase(std::unique(cand.begin(), cand.end()), cand.end());
+	for (size_t c= 0; c < cand.size(); c++) {
+		const long i = cand[c];
+		if (i == id) continue;
+		Nbr b;
+		b.d2 = D2(i, id);
+		b.id = id;
+		if (!Offer(rows[i], b, k)) continue;
+		Classify(i);
+		changed.push_back(i);
+	}
+	std::sort(changed.begin(), changed.end());
+	return id;
+}
+
+void DynamicKnn::Insert(const std::vector<double>& x,
+						const std::vector<double>& y,
+						std::vector<long>& changed)
+{
+	std::vector<long> rows_changed;
+	changed.clear();
+	for (size_t i= 0; i < x.size() && i < y.size(); i++) {
+		Insert(x[i], y[i], rows_changed);
+		changed.insert(changed.end(), rows_changed.begin(),
+					   rows_changed.end());
+	}
+	std::sort(changed.begin(), changed.end());
+	changed.erase(std::unique(changed.begin(), changed.end()),
+				  changed.end());
+}
+
+bool DynamicKnn::Remove(const long id, std::vector<long>& changed)
+{
+	changed.clear();
+	if (!IsLive(id)) return false;
+	const int64_t key = Key(CellOf(xs[id]), CellOf(ys[id]));
+	std::vector<long>& in_cell = cells[key];
+	*std::find(in_cell.begin(), in_cell.end(), id) = in_cell.back();
+	in_cell.pop_back();
+	if (in_cell.empty()) cells.erase(key);
+	alive[id] = 0;
+	--live;
+	wide.erase(id);
+	Row().swap(rows[id]);
+
+	// the rows that can hold id, as in Insert; those that do are searched
+	// again
+	std::vector<long> cand;
+	Nearby(xs[id], ys[id], 3, cand);
+	cand.insert(cand.end(), wide.begin(), wide.end());
+	std::sort(cand.begin(), cand.end());
+	cand.erase(std::unique(cand.begin(), cand.end()), cand.end());
+	for (size_t c= 0; c < cand.size(); c++) {
+		const long i = cand[c];
+		Row& row = rows[i];
+		size_t j = 0;
+		while (j < row.size() && row[j].id != id) j++;
+		if (j == row.size()) continue;
+		Search(xs[i], ys[i], i, row);
+		Classify(i);
+		changed.push_back(i);
+	}
+	return true;
+}
+
+double DynamicKnn::Distance(const long id, const int j) const
+{
+	return sqrt(rows[id][j].d2);
+}
+
+GwtElement* DynamicKnn::Gwt(WeightsArena* arena) const
+{
+	const long n = Ids();
+	if (n == 0) return NULL;
+	GwtElement* gwt = new GwtElement[n];
+	for (long i= 0; i < n; i++) {
+		if (rows[i].empty()) continue;
+		gwt[i].alloc((int) rows[i].size(), arena);
+		for (size_t j= 0; j < rows[i].size(); j++) {
+			gwt[i].Push(GwtNeighbor(rows[i][j].id, sqrt(rows[i][j].d2)));
+		}
+	}
+	return gwt;
+}
+
+long DynamicKnn::CellOf(const double c) const
+{
+	double f = floor(c / cell);
+	if (f > MaxCell) f = MaxCell; else if (f < -MaxCell) f = -MaxCell;
+	return (long) f;
+}
+
+/* buckets live point id and widens the cell range to it */
+void DynamicKnn::Add(const long id)
+{
+	const long cx = CellOf(xs[id]), cy = CellOf(ys[id]);
+	cells[Key(cx, cy)].push_back(id);
+	if (live == 1 || cx < lo_x) lo_x = cx;
+	if (live == 1 || cx > hi_x) hi_x = cx;
+	if (live == 1 || cy < lo_y) lo_y = cy;
+	if (live == 1 || cy > hi_y) hi_y = cy;
+}
+
+/* the k nearest live points of (qx, qy) other than self, by rings of
+ cells around it until no closer point can remain */
+void DynamicKnn::Search(const double qx, const double qy, const long self,
+						Row& row) const
+{
+	row.clear();
+	const long others = live - (IsLive(self) ? 1 : 0);
+	const int want = others < k ? (int) others : k;
+	if (want == 0) return;
+	const long cx = CellOf(qx), cy = CellOf(qy);
+	for (long r= 0; ; ++r) {
+		const long x0 = std::max(cx - r, lo_x), x1 = std::min(cx + r, hi_x);
+		const long y0 = std::max(cy - r, lo_y), y1 = std::min(cy + r, hi_y);
+		for (long i= x0; i <= x1; ++i) {
+			const bool edge = i == cx - r || i == cx + r;
+			// the ring only: the inside was searched with smaller r
+			for (long j= edge ? y0 : cy - r; j <= y1; j += edge ? 1 : 2*r) {
+				if (j < y0) continue;
+				Cells::const_iterator c = cells.find(Key(i, j));
+				if (c == cells.end()) continue;
+				const std::vector<long>& ids = c->second;
+				for (size_t p= 0; p < ids.size(); p++) {
+					if (ids[p] == self) continue;
+					const double dx = xs[ids[p]] - qx, dy = ys[ids[p]] - qy;
+					Nbr b;
+					b.d2 = dx*dx + dy*dy;
+					b.id = ids[p];
+					Offer(row, b, want);
+				}
+			}
+		}
+		// points beyond ring r are at least r cells away
+		const double reach = r * cell * (1 - 1e-9);
+		if ((int) row.size() == want && row.back().d2 < reach*reach) break;
+		if (cx - r <= lo_x && cx + r >= hi_x &&
+			cy - r <= lo_y && cy + r >= hi_y) break;
+	}
+}
+
+/* appends the live points in the cells at most reach cells from the
+ cell of (qx, qy) */
+void DynamicKnn::Nearby(const double qx, const double qy, const int reach,
+						std::vector<long>& ids) const
+{
+	const long cx = CellOf(qx), cy = CellOf(qy);
+	for (long i= cx - reach; i <= cx + reach; ++i) {
+		for (long j= cy - reach; j <= cy + reach; ++j) {
+			Cells::const_iterator c = cells.find(Key(i, j));
+			if (c != cells.end()) {
+				ids.insert(ids.end(), c->second.begin(), c->second.end());
+			}
+		}
+	}
+}
+
+/* a point is wide when its row is short or its k-th neighbor is more
+ than 2 cells away */
+void DynamicKnn::Classify(const long id)
+{
+	const Row& row = rows[id];
+	if ((int) row.size() < k || row.back().d2 > 4 * cell * cell) {
+		wide.insert(id);
+	} else {
+		wide.erase(id);
+	}
+}
+
+/* picks a cell side for about k live points a cell over their bounding
+ box and buckets them again */
+void DynamicKnn::Rebucket()
+{
+	cells.clear();
+	wide.clear();
+	double min_x = 0, max_x = 0, min_y = 0, max_y = 0;
+	bool first = true;
+	long i, n = Ids();
+	for (i= 0; i < n; i++) {
+		if (!alive[i]) continue;
+		if (first || xs[i] < min_x) min_x = xs[i];
+		if (first || xs[i] > max_x) max_x = xs[i];
+		if (first || ys[i] < min_y) min_y = ys[i];
+		if (first || ys[i] > max_y) max_y = ys[i];
+		first = false;
+	}
+	const double w = max_x - min_x, h = max_y - min_y;
+	cell = 1;
+	if (live > 0 && w * h > 0) {
+		cell = sqrt(w * h * k / live);
+	} else if (live > 0 && w + h > 0) {
+		cell = (w + h) * k / live;
+	}
+	if (!(cell > 0)) cell = 1;
+	// only the points counted so far are bucketed, for Add's cell range
+	const long all = live;
+	live = 0;
+	for (i= 0; i < n; i++) {
+		if (!alive[i]) continue;
+		++live;
+		Add(i);
+	}
+	live = all;
+	for (i= 0; i < n; i++) {
+		if (alive[i]) Classify(i);
+	}
+	rebucket_at = std::max(2 * live, (long) 64);
+}
@@ -0,0 +1,127 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_DYNAMIC_KNN_H__
+#define __GEODA_CENTER_DYNAMIC_KNN_H__
+
+#include <map>
+#include <set>
+#include <stdint.h>
+#include <vector>
+#include "GwtWeight.h"
+
+/*
+ DynamicKnn
+ Euclidean k nearest neighbor graph of a point set that changes one
+ point at a time, e.g. incidents appended to a layer as they arrive.
+ Each row holds the k nearest other live points, nearest first and ties
+ by id, exactly as a rebuild with AllKNN would give them.  Insert and
+ Remove report the rows that changed, so only those need rewriting.
+
+ The points are bucketed in a grid of square cells holding about k
+ points each.  A point whose k-th neighbor is within two cells (a near
+ point) can only gain or lose a neighbor from the 7 x 7 cells around
+ it, so an insertion or deletion only looks at those cells plus the few
+ wide points with a larger radius, and repairs the rows that contained
+ a deleted point with fresh grid searches.  Each update thus costs time
+ independent of the size of the layer, except for an occasional
+ rebucketing into smaller cells when the layer doubles.
+
+ Ids are assigned in insertion order, starting with the points given to
+ Init; removed ids are not reused.
+ */
+class DynamicKnn {
+public:
+	DynamicKnn(const int k) : k(k > 0 ? k : 1), live(0), rebucket_at(0),
+	cell(1), lo_x(0), hi_x(0), lo_y(0), hi_y(0) {}
+
+	/** the graph of the points (x[i], y[i]), ids 0 .. x.size()-1; the
+	 rows come from AllKNN on nthreads threads (0: all processors) */
+	bool Init(const std::vector<double>& x, const std::vector<double>& y,
+			  int nthreads= 0);
+	/** as Init, with the rows given, e.g. read back from a .gwt file: k
+	 other points per row, in any order (ignored when there are no more
+	 than k points).  They are taken to be the k nearest; false, and
+	 unchanged, when a row does not hold k distinct other points */
+	bool Init(const std::vector<double>& x, const std::vector<double>& y,
+			  const GwtElement* gwt);
+	/** adds a point and returns its id; changed gets the new point and
+	 every row it entered, sorted */
+	long Insert(const double x, const double y, std::vector<long>& changed);
+	/** adds the points in turn; changed gets their ids and every row that
+	 changed, sorted and without repetitions */
+	void Insert(const std::vector<double>& x, const std::vector<double>& y,
+				std::vector<long>& changed);
+	/** removes point id; changed gets the rows that lost it (and found a
+	 new neighbor instead), sorted.  False when id is not live */
+	bool Remove(const long id, std::vector<long>& changed);
+
+	int K() const { return k; }
+	/** number of ids given out, live or removed */
+	long Ids() const { return (long) xs.size(); }
+	long Live() const { return live; }
+	bool IsLive(const long id) const {
+		return id >= 0 && id < Ids() && alive[id]; }
+	/** size of row id: k, or fewer when there are not k other points */
+	int RowSize(const long id) const { return (int) rows[id].size(); }
+	long Neighbor(const long id, const int j) const {
+		return rows[id][j].id; }
+	double Distance(const long id, const int j) const;
+	/** all rows as in AllKNN, weighted by distance, empty for removed
+	 ids; Ids() elements */
+	GwtElement* Gwt(WeightsArena* arena= 0) const;
+
+private:
+	struct Nbr {
+		double d2;
+		long id;
+		bool operator<(const Nbr& b) const {
+			return d2 < b.d2 || (d2 == b.d2 && id < b.id); }
+	};
+	typedef std::vector<Nbr> Row;
+	typedef std::map<int64_t, std::vector<long> > Cells;
+
+	static int64_t Key(const long cx, const long cy) {
+		return (int64_t) cx * ((int64_t) 1 << 32) + (int64_t) cy; }
+	static bool Offer(Row& row, const Nbr& b, const int k);
+	long CellOf(const double c) const;
+	void Add(const long id);
+	void Search(const double qx, const double qy, const long self,
+				Row& row) const;
+	void Nearby(const double qx, const double qy, const int reach,
+				std::vector<long>& ids) const;
+	void Classify(const long id);
+	void Rebucket();
+	double D2(const long a, const long b) const {
+		const double dx = xs[a] - xs[b], dy = ys[a] - ys[b];
+		return dx*dx + dy*dy; }
+
+	int k;
+	long live;
+	long rebucket_at;            // live count that triggers Rebucket
+	double cell;                 // side of a grid cell
+	long lo_x, hi_x, lo_y, hi_y; // cell range of the live points
+	std::vector<double> xs, ys;
+	std::vector<char> alive;
+	std::vector<Row> rows;
+	Cells cells;                 // live ids by cell
+	std::set<long> wide;         // live ids whose radius exceeds 2 cells
+};
+
+#endif
@@ -0,0 +1,147 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include "GalCompressed.h"
+
+long GalCompressedElement::elt(const long where) const
+{
+	unsigned long v;
+	const unsigned char* p = GalVarint::Get(first, v);
+	long nbr = obs + GalVarint::UnZigZag(v);
+	for (long cnt= 0; cnt < where; ++cnt) {
+		p = GalVarint::Get(p, v);
+		nbr += (long) v;
+	}
+	return nbr;
+}
+
+long GalCompressedElement::Decode(long* buf) const
+{
+	if (size == 0) return 0;
+	unsigned long v;
+	const unsigned char* p = GalVarint::Get(first, v);
+	long nbr = obs + GalVarint::UnZigZag(v);
+	buf[0] = nbr;
+	for (long cnt= 1; cnt < size; ++cnt) {
+		p = GalVarint::Get(p, v);
+		nbr += (long) v;
+		buf[cnt] = nbr;
+	}
+	return size;
+}
+
+//*** compute spatial lag for a compressed contiguity row
+//*** optionally (default) performs standardization of the result
+double GalCompressedElement::SpatialLag(const double* x, const bool std) const
+{
+	if (size == 0) return 0;
+	unsigned long v;
+	const unsigned char* p = GalVarint::Get(first, v);
+	long nbr = obs + GalVarint::UnZigZag(v);
+	double lag = x[nbr];
+	for (long cnt= 1; cnt < size; ++cnt) {
+		p = GalVarint::Get(p, v);
+		nbr += (long) v;
+		lag += x[nbr];
+	}
+	if (std && size > 1)
+		lag /= size;
+	return lag;
+}
+
+double GalCompressedElement::SpatialLag(const double* x, const int* perm,
+										const bool std) const
+{
+	if (size == 0) return 0;
+	unsigned long v;
+	const unsigned char* p = GalVarint::Get(first, v);
+	long nbr = obs + GalVarint::UnZigZag(v);
+	double lag = x[perm[nbr]];
+	for (long cnt= 1; cnt < size; ++cnt) {
+		p = GalVarint::Get(p, v);
+		nbr += (long) v;
+		lag += x[perm[nbr]];
+	}
+	if (std && size > 1)
+		lag /= size;
+	return lag;
+}
+
+void GalCompressed::Append(const long* nbrs, long sz)
+{
+	if (num_obs % BlockRows == 0) blocks.push_back(bytes.size());
+	// a varint of a 64 bit value takes at most 10 bytes
+	size_t pos = bytes.size();
+	bytes.resize(pos + 10 * (sz + 1));
+	unsigned char* p = &bytes[0] + pos;
+	p = GalVarint::Put(p, (unsigned long) (sz > 0 ? sz : 0));
+	if (sz > 0) {
+		sorted.assign(nbrs, nbrs + sz);
+		std::sort(sorted.begin(), sorted.end());
+		p = GalVarint::Put(p, GalVarint::ZigZag(sorted[0] - num_obs));
+		for (long cnt= 1; cnt < sz; ++cnt)
+			p = GalVarint::Put(p, (unsigned long) (sorted[cnt]-sorted[cnt-1]));
+	}
+	bytes.resize(p - &bytes[0]);
+	++num_obs;
+}
+
+void GalCompressed::Shrink()
+{
+	std::vector<unsigned char>(bytes).swap(bytes);
+	std::vector<size_t>(blocks).swap(blocks);
+	std::vector<long>().swap(sorted);
+}
+
+const unsigned char* GalCompressed::Row(const long obs) const
+{
+	const unsigned char* p = &bytes[0] + blocks[obs / BlockRows];
+	for (long cnt= obs % BlockRows; cnt > 0; --cnt) {
+		unsigned long sz;
+		p = GalVarint::Get(p, sz);
+		p = GalVarint::Skip(p, (long) sz);
+	}
+	return p;
+}
+
+void GalCompressed::SpatialLagAll(const double* x, double* lag,
+								  const bool std) const
+{
+	if (num_obs == 0) return;
+	const unsigned char* p = &bytes[0];
+	for (long obs= 0; obs < num_obs; ++obs) {
+		unsigned long v;
+		p = GalVarint::Get(p, v);
+		long sz = (long) v;
+		double sum = 0;
+		if (sz > 0) {
+			p = GalVarint::Get(p, v);
+			long nbr = obs + GalVarint::UnZigZag(v);
+			sum = x[nbr];
+			for (long cnt= 1; cnt < sz; ++cnt) {
+				p = GalVarint::Get(p, v);
+				nbr += (long) v;
+				sum += x[nbr];
+			}
+		}
+		if (std && sz > 1) sum /= sz;
+		lag[obs] = sum;
+	}
+}
@@ -0,0 +1,151 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_GAL_COMPRESSED_H__
+#define __GEODA_CENTER_GAL_COMPRESSED_H__
+
+#include <vector>
+#include <cstddef>
+
+/*
+ Varint coding: 7 bits per byte, low bits first, high bit set on every
+ byte but the last.
+ */
+namespace GalVarint {
+	inline unsigned char* Put(unsigned char* p, unsigned long v) {
+		while (v >= 0x80) { *p++ = (unsigned char) (v | 0x80); v >>= 7; }
+		*p++ = (unsigned char) v;
+		return p;
+	}
+	inline const unsigned char* Get(const unsigned char* p, unsigned long& v) {
+		unsigned long b = *p++;
+		v = b & 0x7f;
+		for (int shift= 7; b & 0x80; shift += 7) {
+			b = *p++;
+			v |= (b & 0x7f) << shift;
+		}
+		return p;
+	}
+	/** skips cnt varints */
+	inline const unsigned char* Skip(const unsigned char* p, long cnt) {
+		while (cnt > 0) { if (!(*p++ & 0x80)) --cnt; }
+		return p;
+	}
+	inline unsigned long ZigZag(long v) {
+		return v < 0 ? ((unsigned long) (-(v+1)) << 1) | 1
+					 : (unsigned long) v << 1; }
+	inline long UnZigZag(unsigned long v) {
+		return (v & 1) ? -(long) (v >> 1) - 1 : (long) (v >> 1); }
+}
+
+/*
+ GalCompressedElement
+ Read-only view of one row of a GalCompressed matrix.  Offers the
+ GalElement calls used by the statistics (Size, elt, SpatialLag), so code
+ written against W[obs] works with either representation.
+ */
+class GalCompressedElement {
+public:
+	GalCompressedElement(const unsigned char* row, long obs)
+	: obs(obs) {
+		unsigned long sz;
+		first = GalVarint::Get(row, sz);
+		size = (long) sz;
+	}
+	long Size() const { return size; }
+	long elt(const long where) const;
+	/** writes the neighbors into buf (Size() entries), returns Size() */
+	long Decode(long* buf) const;
+	double SpatialLag(const std::vector<double>& x, const bool std=true) const {
+		return x.empty() ? 0 : SpatialLag(&x[0], std); }
+	double SpatialLag(const double* x, const bool std=true) const;
+	double SpatialLag(const double* x, const int* perm,
+					  const bool std=true) const;
+	double SpatialLag(const std::vector<double>& x, const int* perm,
+					  const bool std=true) const {
+		return x.empty() ? 0 : SpatialLag(&x[0], perm, std); }
+private:
+	long obs;
+	long size;
+	const unsigned char* first; // first neighbor delta
+};
+
+/*
+ GalCompressed
+ Contiguity matrix with each row stored as: varint(size),
+ zigzag varint(first neighbor - obs), then varint gaps between the
+ following neighbors, which are kept sorted.  Rows are grouped in blocks
+ of BlockRows; only the byte offset of each block is stored, so locating
+ a row decodes at most BlockRows-1 row headers.  Sequential passes
+ (SpatialLagAll, NextRow) do not need the block index at all.
+ */
+class GalCompressed {
+public:
+	static const int BlockRows = 16;
+
+	GalCompressed() : num_obs(0) {}
+
+	/** appends the next row; nbrs need not be sorted */
+	void Append(const long* nbrs, long sz);
+	/** gal: obs elements with Size() and dt(), e.g. GalElement */
+	template <class Element> bool Build(const Element* gal, long obs) {
+		if (gal == NULL || obs < 1) return false;
+		bytes.clear();
+		blocks.clear();
+		num_obs = 0;
+		for (long cnt= 0; cnt < obs; ++cnt)
+			Append(gal[cnt].dt(), gal[cnt].Size());
+		Shrink();
+		return true; }
+	/** releases the slack left by Append */
+	void Shrink();
+
+	long NumObs() const { return num_obs; }
+	size_t Bytes() const {
+		return bytes.size() + blocks.size() * sizeof(size_t); }
+
+	GalCompressedElement operator[](const long obs) const {
+		return GalCompressedElement(Row(obs), obs); }
+	long Size(const long obs) const { return (*this)[obs].Size(); }
+	long Decode(const long obs, long* buf) const {
+		return (*this)[obs].Decode(buf); }
+
+	/** lag[i] = W[i].SpatialLag(x, std) for every row in one pass */
+	void SpatialLagAll(const double* x, double* lag,
+					   const bool std=true) const;
+	/** the rows decoded, one Element (GalElement) per observation */
+	template <class Element> Element* ToGal() const {
+		Element* gal = new Element[num_obs];
+		for (long obs= 0; obs < num_obs; ++obs) {
+			GalCompressedElement e = (*this)[obs];
+			if (e.Size() > 0 && gal[obs].alloc(e.Size()))
+				gal[obs].size = e.Decode(gal[obs].dt());
+		}
+		return gal; }
+
+private:
+	const unsigned char* Row(const long obs) const;
+
+	long num_obs;
+	std::vector<unsigned char> bytes;
+	std::vector<size_t> blocks; // offset of every BlockRows-th row
+	std::vector<long> sorted;   // scratch for Append
+};
+
+#endif
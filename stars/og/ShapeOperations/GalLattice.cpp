@@ -0,0 +1,95 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GalLattice.h"
+
+bool GalLattice::SetMask(const std::vector<unsigned char>& empty)
+{
+	long cells = rows*cols, cell;
+	if ((long) empty.size() != cells) return false;
+	masked = true;
+	cell_obs.assign(cells, -1);
+	obs_cell.clear();
+	for (cell= 0; cell < cells; ++cell) {
+		if (empty[cell]) continue;
+		cell_obs[cell] = (long) obs_cell.size();
+		obs_cell.push_back(cell);
+	}
+	num_obs = (long) obs_cell.size();
+	return true;
+}
+
+long GalLattice::Neighbors(const long obs, long* buf) const
+{
+	const long cell = Cell(obs), r = cell / cols, c = cell % cols;
+	const long r0 = r > 0 ? r-1 : r, r1 = r < rows-1 ? r+1 : r;
+	const long c0 = c > 0 ? c-1 : c, c1 = c < cols-1 ? c+1 : c;
+	long sz = 0;
+	// visited in cell order, so the neighbors come out ascending
+	for (long i= r0; i <= r1; ++i) {
+		for (long j= c0; j <= c1; ++j) {
+			if (i == r && j == c) continue;
+			if (!queen && i != r && j != c) continue;
+			long nb = Obs(i*cols + j);
+			if (nb >= 0) buf[sz++] = nb;
+		}
+	}
+	return sz;
+}
+
+//*** compute spatial lag of every lattice observation
+//*** optionally (default) performs standardization of the result
+void GalLattice::SpatialLagAll(const double* x, double* lag,
+							   const bool std) const
+{
+	long obs, r, c;
+	if (masked || rows < 3 || cols < 3) {
+		long nb[8];
+		for (obs= 0; obs < num_obs; ++obs) {
+			long sz = Neighbors(obs, nb);
+			double sum = 0;
+			for (long cnt= 0; cnt < sz; ++cnt) sum += x[nb[cnt]];
+			if (std && sz > 1) sum /= sz;
+			lag[obs] = sum;
+		}
+		return;
+	}
+	// full lattice: interior cells have a fixed stencil, only the border
+	// needs Neighbors
+	const double div = std ? (queen ? 8.0 : 4.0) : 1.0;
+	for (r= 0; r < rows; ++r) {
+		if (r == 0 || r == rows-1) {
+			for (c= 0; c < cols; ++c) lag[r*cols + c] = (*this)[r*cols + c]
+				.SpatialLag(x, std);
+			continue;
+		}
+		obs = r*cols;
+		lag[obs] = (*this)[obs].SpatialLag(x, std);
+		const double* up = x + obs - cols;
+		const double* mid = x + obs;
+		const double* down = x + obs + cols;
+		for (c= 1; c < cols-1; ++c) {
+			double sum = up[c] + mid[c-1] + mid[c+1] + down[c];
+			if (queen) sum += up[c-1] + up[c+1] + down[c-1] + down[c+1];
+			lag[obs + c] = sum / div;
+		}
+		obs += cols-1;
+		lag[obs] = (*this)[obs].SpatialLag(x, std);
+	}
+}
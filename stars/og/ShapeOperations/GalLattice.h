@@ -0,0 +1,128 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_GAL_LATTICE_H__
+#define __GEODA_CENTER_GAL_LATTICE_H__
+
+#include <vector>
+
+class GalLattice;
+
+/*
+ GalLatticeElement
+ Neighbors of one lattice observation, worked out from its row and
+ column when the view is made.  Offers the GalElement calls used by the
+ statistics (Size, elt, SpatialLag), like GalCompressedElement.
+ */
+class GalLatticeElement {
+public:
+	GalLatticeElement(const GalLattice& W, const long obs);
+	long Size() const { return size; }
+	long elt(const long where) const { return nbrs[where]; }
+	const long* dt() const { return nbrs; }
+	double SpatialLag(const std::vector<double>& x, const bool std=true) const {
+		return x.empty() ? 0 : SpatialLag(&x[0], std); }
+	double SpatialLag(const double* x, const bool std=true) const {
+		double lag= 0;
+		for (long cnt= 0; cnt < size; ++cnt) lag += x[nbrs[cnt]];
+		if (std && size > 1) lag /= size;
+		return lag; }
+	double SpatialLag(const double* x, const int* perm,
+					  const bool std=true) const {
+		double lag= 0;
+		for (long cnt= 0; cnt < size; ++cnt) lag += x[perm[nbrs[cnt]]];
+		if (std && size > 1) lag /= size;
+		return lag; }
+	double SpatialLag(const std::vector<double>& x, const int* perm,
+					  const bool std=true) const {
+		return x.empty() ? 0 : SpatialLag(&x[0], perm, std); }
+private:
+	long size;
+	long nbrs[8];
+};
+
+/*
+ GalLattice
+ Rook or queen contiguity of a regular grid of rows x cols cells, cell
+ r*cols + c.  No neighbor lists are stored: the neighbors of a cell are
+ found by index arithmetic.  An optional mask marks empty cells, which
+ are not observations; the observations are the other cells in cell
+ order, as model/PointsToGrid.py writes them.  Only a masked lattice
+ keeps the cell <-> observation maps.  PointsToGrid writes the cells x
+ first, so its grids are rows = grid_width, cols = grid_height.
+ */
+class GalLattice {
+public:
+	GalLattice(const long rows= 0, const long cols= 0, const bool queen= false)
+	: rows(rows), cols(cols), queen(queen), masked(false),
+	num_obs(rows*cols) {}
+
+	/** empty[cell] != 0 marks an empty cell; rows*cols entries */
+	bool SetMask(const std::vector<unsigned char>& empty);
+	bool HasMask() const { return masked; }
+
+	long NumObs() const { return num_obs; }
+	long Rows() const { return rows; }
+	long Cols() const { return cols; }
+	bool IsQueen() const { return queen; }
+	long Cell(const long obs) const {
+		return masked ? obs_cell[obs] : obs; }
+	/** observation in cell, or -1 for an empty cell */
+	long Obs(const long cell) const {
+		return masked ? cell_obs[cell] : cell; }
+
+	/** writes the neighbors of obs in ascending order into buf (at most
+	 8 entries), returns their number */
+	long Neighbors(const long obs, long* buf) const;
+	GalLatticeElement operator[](const long obs) const {
+		return GalLatticeElement(*this, obs); }
+	long Size(const long obs) const { return (*this)[obs].Size(); }
+
+	/** lag[i] = W[i].SpatialLag(x, std) for every observation */
+	void SpatialLagAll(const double* x, double* lag,
+					   const bool std=true) const;
+	/** the neighbor lists written out, one Element (GalElement) per
+	 observation */
+	template <class Element> Element* ToGal() const {
+		Element* gal = new Element[num_obs];
+		long nb[8];
+		for (long obs= 0; obs < num_obs; ++obs) {
+			long sz = Neighbors(obs, nb);
+			if (sz > 0 && gal[obs].alloc(sz)) {
+				for (long cnt= 0; cnt < sz; ++cnt) gal[obs].Push(nb[cnt]);
+			}
+		}
+		return gal; }
+
+private:
+	long rows, cols;
+	bool queen;
+	bool masked;
+	long num_obs;
+	std::vector<long> cell_obs; // masked lattices only
+	std::vector<long> obs_cell;
+};
+
+inline GalLatticeElement::GalLatticeElement(const GalLattice& W,
+											const long obs)
+{
+	size = W.Neighbors(obs, nbrs);
+}
+
+#endif
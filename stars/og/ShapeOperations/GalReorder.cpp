@@ -0,0 +1,91 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include "GalReorder.h"
+
+/* distance of cell (x, y) along the Hilbert curve filling a 2^bits grid */
+static uint64_t HilbertIndex(uint32_t x, uint32_t y, int bits)
+{
+	uint64_t d = 0;
+	for (uint32_t s= (uint32_t) 1 << (bits-1); s > 0; s >>= 1) {
+		uint32_t rx = (x & s) > 0, ry = (y & s) > 0;
+		d += (uint64_t) s * s * ((3 * rx) ^ ry);
+		if (ry == 0) {           // rotate the quadrant
+			if (rx == 1) {
+				x = s-1 - (x & (s-1));
+				y = s-1 - (y & (s-1));
+			}
+			uint32_t t = x; x = y; y = t;
+		}
+	}
+	return d;
+}
+
+bool WeightsReorder::HilbertOrder(const std::vector<double>& x,
+								  const std::vector<double>& y,
+								  std::vector<long>& order)
+{
+	long obs = (long) x.size(), i;
+	if (obs < 1 || x.size() != y.size()) return false;
+	double xmin = x[0], xmax = x[0], ymin = y[0], ymax = y[0];
+	for (i= 1; i < obs; ++i) {
+		if (x[i] < xmin) xmin = x[i]; else if (x[i] > xmax) xmax = x[i];
+		if (y[i] < ymin) ymin = y[i]; else if (y[i] > ymax) ymax = y[i];
+	}
+	const int bits = 21;
+	const double cells = (double) ((1 << bits) - 1);
+	double range = xmax - xmin > ymax - ymin ? xmax - xmin : ymax - ymin;
+	double scale = range > 0 ? cells / range : 0;
+
+	std::vector< std::pair<uint64_t, long> > keys(obs);
+	for (i= 0; i < obs; ++i) {
+		uint32_t hx = (uint32_t) ((x[i] - xmin) * scale);
+		uint32_t hy = (uint32_t) ((y[i] - ymin) * scale);
+		keys[i] = std::make_pair(HilbertIndex(hx, hy, bits), i);
+	}
+	std::sort(keys.begin(), keys.end());
+	order.resize(obs);
+	for (i= 0; i < obs; ++i) order[i] = keys[i].second;
+	return true;
+}
+
+bool GalReorder::SetOrder(const std::vector<long>& ord)
+{
+	long obs = (long) ord.size();
+	std::vector<long> rnk(obs, -1);
+	for (long i= 0; i < obs; ++i) {
+		if (ord[i] < 0 || ord[i] >= obs || rnk[ord[i]] >= 0) return false;
+		rnk[ord[i]] = i;
+	}
+	order = ord;
+	rank.swap(rnk);
+	return true;
+}
+
+void GalReorder::SpatialLagAll(const double* x, double* lag,
+							   const bool std) const
+{
+	const long obs = NumObs();
+	if (obs < 1) return;
+	std::vector<double> px(obs);
+	Permute(x, &px[0]);
+	for (long pos= 0; pos < obs; ++pos)
+		lag[order[pos]] = (*this)[pos].SpatialLag(&px[0], std);
+}
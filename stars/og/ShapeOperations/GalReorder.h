@@ -0,0 +1,212 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_GAL_REORDER_H__
+#define __GEODA_CENTER_GAL_REORDER_H__
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+/*
+ Observation orders that keep neighbors close in memory.  An order is a
+ vector with order[new position] = original observation.
+ */
+namespace WeightsReorder {
+	/** Hilbert curve order of the points (x, y) */
+	bool HilbertOrder(const std::vector<double>& x,
+					  const std::vector<double>& y,
+					  std::vector<long>& order);
+	/** reverse Cuthill-McKee order of the contiguity graph W, obs
+	 elements with Size() and elt(), e.g. GalElement */
+	template <class Element>
+	bool RCMOrder(const Element* W, const long obs,
+				  std::vector<long>& order);
+}
+
+template <class Element>
+bool WeightsReorder::RCMOrder(const Element* W, const long obs,
+							  std::vector<long>& order)
+{
+	if (W == NULL || obs < 1) return false;
+	order.clear();
+	order.reserve(obs);
+	std::vector<long> level(obs, -1), queue;
+	std::vector<char> done(obs, 0);
+	std::vector< std::pair<long, long> > nbrs; // (degree, neighbor)
+
+	// roots are taken in order of increasing degree
+	std::vector< std::pair<long, long> > by_degree(obs);
+	long i;
+	for (i= 0; i < obs; ++i) by_degree[i] = std::make_pair(W[i].Size(), i);
+	std::sort(by_degree.begin(), by_degree.end());
+
+	for (long r= 0; r < obs; ++r) {
+		long root = by_degree[r].second;
+		if (done[root]) continue;
+		// pseudo-peripheral root: walk to the far end of the component
+		// until the eccentricity stops growing
+		long depth = -1;
+		for (int tries= 0; tries < 4; ++tries) {
+			queue.clear();
+			queue.push_back(root);
+			level[root] = 0;
+			for (size_t h= 0; h < queue.size(); ++h) {
+				long u = queue[h];
+				for (long j= 0, sz= W[u].Size(); j < sz; ++j) {
+					long v = W[u].elt(j);
+					if (level[v] < 0) {
+						level[v] = level[u] + 1;
+						queue.push_back(v);
+					}
+				}
+			}
+			long ecc = level[queue.back()], far = queue.back();
+			for (size_t h= queue.size(); h-- > 0 && level[queue[h]] == ecc;) {
+				if (W[queue[h]].Size() < W[far].Size()) far = queue[h];
+			}
+			for (size_t h= 0; h < queue.size(); ++h) level[queue[h]] = -1;
+			if (ecc <= depth) break;
+			depth = ecc;
+			root = far;
+		}
+		// Cuthill-McKee from root, neighbors by increasing degree
+		size_t start = order.size();
+		order.push_back(root);
+		done[root] = 1;
+		for (size_t h= start; h < order.size(); ++h) {
+			long u = order[h];
+			nbrs.clear();
+			for (long j= 0, sz= W[u].Size(); j < sz; ++j) {
+				long v = W[u].elt(j);
+				if (!done[v]) {
+					done[v] = 1;
+					nbrs.push_back(std::make_pair(W[v].Size(), v));
+				}
+			}
+			std::sort(nbrs.begin(), nbrs.end());
+			for (size_t j= 0; j < nbrs.size(); ++j)
+				order.push_back(nbrs[j].second);
+		}
+	}
+	std::reverse(order.begin(), order.end());
+	return true;
+}
+
+/*
+ GalReorderElement
+ One row of a GalReorder, in new positions.  Offers the GalElement calls
+ used by the statistics (Size, elt, SpatialLag).
+ */
+class GalReorderElement {
+public:
+	GalReorderElement(const long* data, const long size)
+	: data(data), size(size) {}
+	long Size() const { return size; }
+	long elt(const long where) const { return data[where]; }
+	const long* dt() const { return data; }
+	double SpatialLag(const std::vector<double>& x, const bool std=true) const {
+		return x.empty() ? 0 : SpatialLag(&x[0], std); }
+	double SpatialLag(const double* x, const bool std=true) const {
+		double lag= 0;
+		for (long cnt= 0; cnt < size; ++cnt) lag += x[data[cnt]];
+		if (std && size > 1) lag /= size;
+		return lag; }
+private:
+	const long* data;
+	long size;
+};
+
+/*
+ GalReorder
+ Contiguity weights renumbered into a locality friendly order, so that
+ the neighbor gathers of a spatial lag pass touch nearby memory when the
+ record order is random with respect to space.  Build permutes the
+ weights once; data go in through Permute and results come back through
+ Unpermute.  SpatialLagAll and GeodaLisa::LISA do both, so their callers
+ see record order only.  The rows are copied, sorted, into one array,
+ and the parent may be released after Build.  The parent is any array of
+ elements with Size() and elt(), e.g. GalElement.
+ */
+class GalReorder {
+public:
+	GalReorder() {}
+
+	/** W renumbered into ord (ord[new] = old, a permutation of
+	 0 .. obs-1) */
+	template <class Element>
+	bool Build(const Element* W, const long obs,
+			   const std::vector<long>& ord) {
+		if (W == NULL || obs < 1 || (long) ord.size() != obs ||
+			!SetOrder(ord)) return false;
+		start.assign(obs + 1, 0);
+		nbrs.clear();
+		for (long pos= 0; pos < obs; ++pos) {
+			const Element& e = W[order[pos]];
+			for (long j= 0, sz= e.Size(); j < sz; ++j)
+				nbrs.push_back(rank[e.elt(j)]);
+			start[pos+1] = (long) nbrs.size();
+			std::sort(nbrs.begin() + start[pos], nbrs.end());
+		}
+		return true; }
+	/** W in reverse Cuthill-McKee order */
+	template <class Element>
+	bool BuildRCM(const Element* W, const long obs) {
+		std::vector<long> ord;
+		return WeightsReorder::RCMOrder(W, obs, ord) && Build(W, obs, ord); }
+	/** W in the Hilbert curve order of the centroids (x, y) */
+	template <class Element>
+	bool BuildHilbert(const Element* W, const std::vector<double>& x,
+					  const std::vector<double>& y) {
+		std::vector<long> ord;
+		return WeightsReorder::HilbertOrder(x, y, ord) &&
+			Build(W, (long) x.size(), ord); }
+
+	long NumObs() const { return (long) order.size(); }
+	/** observation at new position pos */
+	long Order(const long pos) const { return order[pos]; }
+	/** new position of observation obs */
+	long Rank(const long obs) const { return rank[obs]; }
+
+	GalReorderElement operator[](const long pos) const {
+		return GalReorderElement(nbrs.empty() ? 0 : &nbrs[0] + start[pos],
+								 start[pos+1] - start[pos]); }
+	long Size(const long pos) const { return start[pos+1] - start[pos]; }
+
+	/** px[new] = x[old] */
+	template <class T> void Permute(const T* x, T* px) const {
+		for (long i= 0, n= NumObs(); i < n; ++i) px[i] = x[order[i]]; }
+	/** out[old] = r[new] */
+	template <class T> void Unpermute(const T* r, T* out) const {
+		for (long i= 0, n= NumObs(); i < n; ++i) out[order[i]] = r[i]; }
+	/** lag[obs] = W[obs].SpatialLag(x, std) for every observation, x and
+	 lag in record order */
+	void SpatialLagAll(const double* x, double* lag,
+					   const bool std=true) const;
+
+private:
+	bool SetOrder(const std::vector<long>& ord);
+
+	std::vector<long> order; // order[new] = old
+	std::vector<long> rank;  // rank[old] = new
+	std::vector<long> start; // row pos is nbrs[start[pos] .. start[pos+1])
+	std::vector<long> nbrs;
+};
+
+#endif
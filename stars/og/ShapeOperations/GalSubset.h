@@ -0,0 +1,160 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_GAL_SUBSET_H__
+#define __GEODA_CENTER_GAL_SUBSET_H__
+
+#include <algorithm>
+#include <vector>
+
+/*
+ GalSubsetElement
+ One row of a GalSubset, in subset ids.  Offers the GalElement calls
+ used by the statistics (Size, elt, SpatialLag).
+ */
+class GalSubsetElement {
+public:
+	GalSubsetElement(const long* data, const long size)
+	: data(data), size(size) {}
+	long Size() const { return size; }
+	long elt(const long where) const { return data[where]; }
+	const long* dt() const { return data; }
+	double SpatialLag(const std::vector<double>& x, const bool std=true) const {
+		return x.empty() ? 0 : SpatialLag(&x[0], std); }
+	double SpatialLag(const double* x, const bool std=true) const {
+		double lag= 0;
+		for (long cnt= 0; cnt < size; ++cnt) lag += x[data[cnt]];
+		if (std && size > 1) lag /= size;
+		return lag; }
+	double SpatialLag(const double* x, const int* perm,
+					  const bool std=true) const {
+		double lag= 0;
+		for (long cnt= 0; cnt < size; ++cnt) lag += x[perm[data[cnt]]];
+		if (std && size > 1) lag /= size;
+		return lag; }
+	double SpatialLag(const std::vector<double>& x, const int* perm,
+					  const bool std=true) const {
+		return x.empty() ? 0 : SpatialLag(&x[0], perm, std); }
+private:
+	const long* data;
+	long size;
+};
+
+/*
+ GalSubset
+ Contiguity among a selection of the observations of a GalElement array
+ (the induced subgraph), without writing a new weights file.  The
+ selected observations, kept in ascending order, become 0..m-1 and
+ neighbors outside the selection are dropped.  Building costs one binary
+ search per neighbor of a selected row.  A row that loses no neighbors
+ and whose ids do not change, which holds below the first unselected
+ observation, points into the parent row instead of being copied; the
+ parent must outlive the subset.  The parent is any array of elements
+ with Size(), elt() and dt(), e.g. GalElement.
+ */
+class GalSubset {
+public:
+	GalSubset() : shared(0) {}
+
+	/** selected: parent ids, in any order; duplicates are ignored */
+	template <class Element>
+	bool Build(const Element* W, const long obs,
+			   const std::vector<long>& selected) {
+		ids = selected;
+		std::sort(ids.begin(), ids.end());
+		ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+		if (!ids.empty() && (ids[0] < 0 || ids.back() >= obs)) {
+			ids.clear();
+			return false;
+		}
+		return Fill(W);
+	}
+	/** selected[obs] set for every parent observation in the subset */
+	template <class Element>
+	bool Build(const Element* W, const std::vector<bool>& selected) {
+		ids.clear();
+		for (long obs= 0; obs < (long) selected.size(); ++obs)
+			if (selected[obs]) ids.push_back(obs);
+		return Fill(W);
+	}
+
+	long NumObs() const { return (long) ids.size(); }
+	/** parent id of subset observation sub */
+	long Parent(const long sub) const { return ids[sub]; }
+	/** subset id of parent observation obs, or -1 when not selected */
+	long Sub(const long obs) const {
+		std::vector<long>::const_iterator it =
+			std::lower_bound(ids.begin(), ids.end(), obs);
+		return it != ids.end() && *it == obs ? (long) (it - ids.begin()) : -1; }
+
+	GalSubsetElement operator[](const long sub) const {
+		return GalSubsetElement(rows[sub], sizes[sub]); }
+	long Size(const long sub) const { return sizes[sub]; }
+	/** rows that share the parent's storage */
+	long SharedRows() const { return shared; }
+
+private:
+	template <class Element>
+	bool Fill(const Element* W) {
+		long m = (long) ids.size(), sub, cnt;
+		rows.assign(m, (const long*) 0);
+		sizes.assign(m, 0);
+		nbrs.clear();
+		shared = 0;
+		if (m > 0 && !W) {
+			ids.clear(); rows.clear(); sizes.clear();
+			return false;
+		}
+		// ids[sub] == sub for every sub < prefix
+		long prefix = 0;
+		while (prefix < m && ids[prefix] == prefix) ++prefix;
+		std::vector<long> start(m, -1);
+		for (sub= 0; sub < m; ++sub) {
+			const Element& e = W[ids[sub]];
+			const long sz = e.Size();
+			for (cnt= 0; cnt < sz && e.elt(cnt) < prefix; ++cnt) ;
+			if (cnt == sz) {
+				rows[sub] = e.dt();
+				sizes[sub] = sz;
+				++shared;
+				continue;
+			}
+			start[sub] = (long) nbrs.size();
+			for (cnt= 0; cnt < sz; ++cnt) {
+				long nb = Sub(e.elt(cnt));
+				if (nb >= 0) nbrs.push_back(nb);
+			}
+			sizes[sub] = (long) nbrs.size() - start[sub];
+		}
+		for (sub= 0; sub < m; ++sub)
+			if (start[sub] >= 0 && sizes[sub] > 0) rows[sub] = &nbrs[start[sub]];
+		return true;
+	}
+	// rows point into nbrs
+	GalSubset(const GalSubset&);
+	GalSubset& operator=(const GalSubset&);
+
+	std::vector<long> ids;          // subset id -> parent id, ascending
+	std::vector<const long*> rows;  // into the parent or into nbrs
+	std::vector<long> sizes;
+	std::vector<long> nbrs;         // rows that had to be remapped
+	long shared;
+};
+
+#endif
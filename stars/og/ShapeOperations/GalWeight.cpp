@@ -27,6 +27,7 @@
 #include "../GenUtils.h"
 #include "../logger.h"
 #include "GalWeight.h"
+#include "WeightsWriter.h"
 
 //*** compute spatial lag for a contiguity weights matrix
 //*** optionally (default) performs standardization of the result
@@ -96,11 +97,62 @@ double GalElement::SpatialLag(const std::vector<double>& x, const int * perm,
 	return lag;
 }
 
-GalElement* WeightUtils::ReadGal(const char* fname)
+//*** compute spatial lag of obs for a contiguity matrix in CSR form
+//*** optionally (default) performs standardization of the result
+double GalCsr::SpatialLag(const long obs, const double *x,
+						  const bool std) const
+{
+	double    lag= 0;
+	const long* nb = dt(obs);
+	const long sz = Size(obs);
+	for (long cnt= 0; cnt < sz; ++cnt)
+		lag += x[ nb[cnt] ];
+	if (std && sz > 1)
+		lag /= sz;
+	return lag;
+}
+
+double GalCsr::SpatialLag(const long obs, const double *x, const int * perm,
+						  const bool std) const
+{
+	double    lag= 0;
+	const long* nb = dt(obs);
+	const long sz = Size(obs);
+	for (long cnt= 0; cnt < sz; ++cnt)
+		lag += x[ perm[ nb[cnt] ] ];
+	if (std && sz > 1)
+		lag /= sz;
+	return lag;
+}
+
+/** copies the CSR matrix into a newly allocated GalElement array, with
+ the rows taken from arena when one is given */
+GalElement* GalCsr::ToGal(WeightsArena* arena) const
+{
+	long obs = NumObs();
+	GalElement* gal = new GalElement[obs];
+	for (long i=0; i<obs; i++) {
+		long sz = Size(i);
+		if (sz > 0 && gal[i].alloc(sz, arena)) {
+			const long* nb = dt(i);
+			for (long j=0; j<sz; j++) gal[i].Push(nb[j]);
+		}
+	}
+	return gal;
+}
+
+GalElement* WeightUtils::ReadGal(const char* fname, long* n_obs)
 								 //DbfGridTableBase* grid_base) xun
 {
 	LOG_MSG("Entering WeightUtils::ReadGal");
 	using namespace std;
+	if (n_obs) *n_obs = 0;
+	if (WeightsBinary::Is(fname, WeightsWriter::GalMagic)) {
+		WeightsBinary bin;
+		if (!bin.Read(fname, WeightsWriter::GalMagic)) return 0;
+		if (n_obs) *n_obs = (long) bin.ids.size();
+		return bin.ToGal();
+	}
 	ifstream file;
 	file.open(fname, ios::in);  // a text file
 	if (!(file.is_open() && file.good())) {
@@ -309,6 +361,7 @@ GalElement* WeightUtils::ReadGal(const char* fname)
 	file.clear();
 	if (file.is_open()) file.close();
 	
+	if (n_obs) *n_obs = (long) num_obs;
 	LOG_MSG("Exiting WeightUtils::ReadGal");
 	return gal;
 }
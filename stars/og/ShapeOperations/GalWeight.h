@@ -24,6 +24,7 @@
 #include <vector>
 #include "../GeoDaConst.h"
 #include "GeodaWeight.h"
+#include "WeightsArena.h"
 
 class DbfGridTableBase;
 struct DataPoint;
@@ -32,20 +33,32 @@ class GalElement {
 public:
     long size; // number of neighbors in data array.
     long* data;
+	bool own;  // false when data lives in a WeightsArena
 
 public:
-    GalElement(const long sz=0) : data(0), size(0) {
+    GalElement(const long sz=0) : data(0), size(0), own(true) {
 		if (sz > 0) data = new long[sz]; }
     virtual ~GalElement() {
-        if (data) delete [] data;
+        if (data && own) delete [] data;
 		size = 0; }
     int alloc (const int sz) {
-		if (data) delete [] data;
+		if (data && own) delete [] data;
+		data = 0;
+		own = true;
         if (sz > 0) {
 			size = 0;
 			data = new long[sz];
 		}
         return !empty(); }
+	/** takes the storage from arena, which must outlive this element */
+    int alloc (const int sz, WeightsArena* arena) {
+		if (!arena) return alloc(sz);
+		if (data && own) delete [] data;
+		data = 0;
+		own = false;
+		size = 0;
+		if (sz > 0) data = arena->Alloc<long>(sz);
+        return !empty(); }
     bool empty() const { return data == 0; }
     void Push(const long val) { data[size++] = val; }
     long Pop() {
@@ -65,11 +78,41 @@ public:
 					  const bool std=true) const;
 };
 
+/**
+ GalCsr
+ Contiguity matrix in compressed sparse row form: the neighbors of
+ observation obs are nbrs[offsets[obs]] .. nbrs[offsets[obs+1]-1], in
+ ascending order.  Holds the whole matrix in two allocations.
+ */
+class GalCsr {
+public:
+	std::vector<long> offsets; // num_obs+1 entries, offsets[0] == 0
+	std::vector<long> nbrs;    // offsets[num_obs] entries
+
+public:
+	long NumObs() const {
+		return offsets.empty() ? 0 : (long) offsets.size() - 1; }
+	long NumNbrs() const { return (long) nbrs.size(); }
+	long Size(const long obs) const { return offsets[obs+1]-offsets[obs]; }
+	long elt(const long obs, const long where) const {
+		return nbrs[offsets[obs] + where]; }
+	const long* dt(const long obs) const {
+		return nbrs.empty() ? 0 : &nbrs[0] + offsets[obs]; }
+	double SpatialLag(const long obs, const double* x,
+					  const bool std=true) const;
+	double SpatialLag(const long obs, const double* x, const int* perm,
+					  const bool std=true) const;
+	GalElement* ToGal(WeightsArena* arena=0) const;
+};
+
 class GalWeight : public GeoDaWeight {
 public:
-	GalWeight() : gal(0) { weight_type = gal_type; }
-	virtual ~GalWeight() { if (gal) delete [] gal; gal = 0; }
+	GalWeight() : gal(0), arena(0) { weight_type = gal_type; }
+	virtual ~GalWeight() {
+		delete [] gal; gal = 0;
+		delete arena; arena = 0; }
 	GalElement* gal;
+	WeightsArena* arena; // neighbor storage of gal, if built in an arena
 	static bool HasIsolates(GalElement *gal, int num_obs) {
 		if (!gal) return false;
 		for (int i=0; i<num_obs; i++) { if (gal[i].Size() <= 0) return true; }
@@ -78,7 +121,8 @@ public:
 };
 
 namespace WeightUtils {
-	GalElement* ReadGal(const char* w_fname);//, DbfGridTableBase* grid_base);
+	/** n_obs, when given, gets the number of elements returned */
+	GalElement* ReadGal(const char* w_fname, long* n_obs= 0);//, DbfGridTableBase* grid_base);
 }
 
 #endif
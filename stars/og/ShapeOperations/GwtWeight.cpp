@@ -28,6 +28,7 @@
 #include "../logger.h"
 #include "GalWeight.h"
 #include "GwtWeight.h"
+#include "WeightsWriter.h"
 
 double GwtElement::SpatialLag(const std::vector<double>& x,
 							  const bool std) const
@@ -88,6 +89,10 @@ GalElement* WeightUtils::ReadGwtAsGal(const char* fname)
 {
 	LOG_MSG("Entering WeightUtils::ReadGwtAsGal");
 	using namespace std;
+	if (WeightsBinary::Is(fname, WeightsWriter::GwtMagic)) {
+		WeightsBinary bin;
+		return bin.Read(fname, WeightsWriter::GwtMagic) ? bin.ToGal() : 0;
+	}
 	ifstream file;
 	file.open(fname, ios::in);  // a text file
 	if (!(file.is_open() && file.good())) {
@@ -224,6 +229,10 @@ GwtElement* WeightUtils::ReadGwt(const char* fname)
 {
 	LOG_MSG("Entering WeightUtils::ReadGwt");
 	using namespace std;
+	if (WeightsBinary::Is(fname, WeightsWriter::GwtMagic)) {
+		WeightsBinary bin;
+		return bin.Read(fname, WeightsWriter::GwtMagic) ? bin.ToGwt() : 0;
+	}
 	ifstream file;
 	file.open(fname, ios::in);  // a text file
 	if (!(file.is_open() && file.good())) {
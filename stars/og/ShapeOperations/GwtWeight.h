@@ -24,6 +24,7 @@
 #include <vector>
 #include "../GeoDaConst.h"
 #include "GeodaWeight.h"
+#include "WeightsArena.h"
 
 class GalElement;
 class DbfGridTableBase;
@@ -41,20 +42,33 @@ class GwtElement {
 public:
     long nbrs; // current number of neighbors
     GwtNeighbor* data; // list neighborhood
+	bool own; // false when data lives in a WeightsArena
 	
 public:
-    GwtElement(const long sz=0) : data(0), nbrs(0) {
+    GwtElement(const long sz=0) : data(0), nbrs(0), own(true) {
         if (sz > 0) data = new GwtNeighbor[sz]; }
     virtual ~GwtElement() {
-        if (data) delete [] data;
+        if (data && own) delete [] data;
         nbrs = 0; }
     bool alloc(const int sz) {
-		if (data) delete [] data;
+		if (data && own) delete [] data;
+		data = 0;
+		own = true;
         if (sz > 0) {
 			nbrs = 0;
 			data = new GwtNeighbor[sz];
 		}
         return !empty(); }
+	/** takes the storage from arena, which must outlive this element;
+	 the neighbors are only ever assigned through Push */
+    bool alloc(const int sz, WeightsArena* arena) {
+		if (!arena) return alloc(sz);
+		if (data && own) delete [] data;
+		data = 0;
+		own = false;
+		nbrs = 0;
+		if (sz > 0) data = arena->Alloc<GwtNeighbor>(sz);
+        return !empty(); }
     bool empty() const { return data == 0; }
     void Push(const GwtNeighbor &elt) { data[nbrs++] = elt; }
     GwtNeighbor Pop() {
@@ -75,9 +89,12 @@ public:
 
 class GwtWeight : public GeoDaWeight {
 public:
-	GwtWeight() : gwt(0) { weight_type = gwt_type; }
-	virtual ~GwtWeight() { if (gwt) delete [] gwt; gwt = 0; }
+	GwtWeight() : gwt(0), arena(0) { weight_type = gwt_type; }
+	virtual ~GwtWeight() {
+		delete [] gwt; gwt = 0;
+		delete arena; arena = 0; }
 	GwtElement* gwt;
+	WeightsArena* arena; // neighbor storage of gwt, if built in an arena
 	static bool HasIsolates(GwtElement *gwt, int num_obs) {
 		if (!gwt) return false;
 		for (int i=0; i<num_obs; i++) { if (gwt[i].Size() <= 0) return true; }
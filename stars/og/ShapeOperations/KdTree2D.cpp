@@ -0,0 +1,430 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef _WIN32
+#include <process.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "KdTree2D.h"
+
+/* a node still to visit and the offsets of the query from its cell */
+struct KdTree2DEntry {
+	long node;
+	double off[2];
+};
+
+// median splits keep the depth at log2(n), so 2 entries per level
+static const int KdTree2DStack = 130;
+
+/* orders point ids by one coordinate, ties by id */
+class KdTree2DLess {
+public:
+	KdTree2DLess(const double* c) : c(c) {}
+	bool operator()(const long a, const long b) const {
+		return c[a] < c[b] || (c[a] == c[b] && a < b); }
+private:
+	const double* c;
+};
+
+/* index file header, followed by the nodes and the x, y, id and order
+ arrays */
+struct KdTree2DHeader {
+	char magic[8];
+	uint64_t key;                  // written last, once the rest is there
+	int64_t points, nodes, slots;
+	int32_t node_size, long_size;  // sizeof(Node) and sizeof(long)
+};
+
+static const char KdTree2DMagic[8] = { 'K','D','T','R','E','E','2','D' };
+
+/* maps the whole of file fname read-only; NULL on failure */
+static void* MapFile(const char* fname, size_t& size)
+{
+	void* data = NULL;
+#ifdef _WIN32
+	HANDLE file = CreateFileA(fname, GENERIC_READ, FILE_SHARE_READ, NULL,
+							  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return NULL;
+	LARGE_INTEGER len;
+	if (GetFileSizeEx(file, &len) && len.QuadPart > 0 &&
+		(uint64_t) len.QuadPart <= (size_t) -1) {
+		size = (size_t) len.QuadPart;
+		HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0,
+											NULL);
+		if (mapping) {
+			// the view keeps the mapping alive
+			data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping);
+		}
+	}
+	CloseHandle(file);
+#else
+	int fd = open(fname, O_RDONLY);
+	if (fd < 0) return NULL;
+	struct stat st;
+	if (fstat(fd, &st) == 0 && st.st_size > 0) {
+		size = (size_t) st.st_size;
+		data = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+		if (data == MAP_FAILED) data = NULL;
+	}
+	close(fd);
+#endif
+	return data;
+}
+
+static void UnmapFile(void* data, size_t size)
+{
+#ifdef _WIN32
+	UnmapViewOfFile(data);
+#else
+	munmap(data, size);
+#endif
+}
+
+KdTree2D::KdTree2D()
+: num_points(0), num_nodes(0), num_slots(0), node_at(0), x_at(0), y_at(0),
+id_at(0), order_at(0), map(0), map_size(0)
+{
+}
+
+KdTree2D::~KdTree2D()
+{
+	Clear();
+}
+
+void KdTree2D::Clear()
+{
+	if (map) UnmapFile(map, map_size);
+	map = NULL;
+	map_size = 0;
+	num_points = num_nodes = num_slots = 0;
+	nodes.clear();
+	xs.clear(); ys.clear();
+	ids.clear();
+	order.clear();
+	node_at = NULL;
+	x_at = y_at = NULL;
+	id_at = order_at = NULL;
+}
+
+uint64_t KdTree2D::Key(const double* x, const double* y, const long n)
+{
+	// FNV-1a, a word at a time
+	const uint64_t prime = 1099511628211ULL;
+	uint64_t h = 14695981039346656037ULL, w;
+	h = (h ^ (uint64_t) n) * prime;
+	for (long i= 0; i < n; ++i) {
+		memcpy(&w, x + i, sizeof w);
+		h = (h ^ w) * prime;
+		memcpy(&w, y + i, sizeof w);
+		h = (h ^ w) * prime;
+	}
+	return h;
+}
+
+bool KdTree2D::Open(const double* x, const double* y, const long n,
+					const char* fname)
+{
+	if (n < 1) {
+		Clear();
+		return false;
+	}
+	const uint64_t key = Key(x, y, n);
+	if (Load(fname, key)) return true;
+	Build(x, y, n);
+	Save(fname, key);
+	return true;
+}
+
+bool KdTree2D::Save(const char* fname, const uint64_t key) const
+{
+	if (num_points == 0) return false;
+	// written aside and renamed over fname, so that a tree another process
+	// has mapped is never truncated under it; a directory that cannot be
+	// written to fails here, quietly
+	char pid[32];
+#ifdef _WIN32
+	sprintf(pid, ".%d.tmp", (int) _getpid());
+#else
+	sprintf(pid, ".%d.tmp", (int) getpid());
+#endif
+	const std::string tmp = std::string(fname) + pid;
+	FILE* f = fopen(tmp.c_str(), "wb");
+	if (!f) return false;
+	KdTree2DHeader h;
+	memset(&h, 0, sizeof h);
+	memcpy(h.magic, KdTree2DMagic, sizeof h.magic);
+	h.points = num_points;
+	h.nodes = num_nodes;
+	h.slots = num_slots;
+	h.node_size = (int32_t) sizeof(Node);
+	h.long_size = (int32_t) sizeof(long);
+	// a file cut short keeps key 0 and is never loaded
+	bool ok = fwrite(&h, sizeof h, 1, f) == 1 &&
+		fwrite(node_at, sizeof(Node), num_nodes, f) == (size_t) num_nodes &&
+		fwrite(x_at, sizeof(double), num_slots, f) == (size_t) num_slots &&
+		fwrite(y_at, sizeof(double), num_slots, f) == (size_t) num_slots &&
+		fwrite(id_at, sizeof(long), num_slots, f) == (size_t) num_slots &&
+		fwrite(order_at, sizeof(long), num_points, f) == (size_t) num_points;
+	h.key = key;
+	ok = ok && fflush(f) == 0 && fseek(f, 0, SEEK_SET) == 0 &&
+		fwrite(&h, sizeof h, 1, f) == 1;
+	ok = fclose(f) == 0 && ok;
+	if (ok && rename(tmp.c_str(), fname) != 0) {
+		// Windows does not rename over an existing file
+		ok = remove(fname) == 0 && rename(tmp.c_str(), fname) == 0;
+	}
+	if (!ok) remove(tmp.c_str());
+	return ok;
+}
+
+bool KdTree2D::Load(const char* fname, const uint64_t key)
+{
+	Clear();
+	size_t size = 0;
+	void* data = MapFile(fname, size);
+	if (!data) return false;
+	KdTree2DHeader h;
+	bool ok = size >= sizeof h;
+	if (ok) {
+		memcpy(&h, data, sizeof h);
+		ok = memcmp(h.magic, KdTree2DMagic, sizeof h.magic) == 0 &&
+			h.key == key && h.node_size == (int32_t) sizeof(Node) &&
+			h.long_size == (int32_t) sizeof(long) && h.points > 0 &&
+			h.nodes > 0 && h.slots >= h.points;
+	}
+	if (ok) {
+		ok = (int64_t) size == (int64_t) sizeof h +
+			h.nodes * (int64_t) sizeof(Node) +
+			h.slots * 2 * (int64_t) sizeof(double) +
+			(h.slots + h.points) * (int64_t) sizeof(long);
+	}
+	if (!ok) {
+		UnmapFile(data, size);
+		return false;
+	}
+	map = data;
+	map_size = size;
+	num_points = (long) h.points;
+	num_nodes = (long) h.nodes;
+	num_slots = (long) h.slots;
+	const char* p = (const char*) data + sizeof h;
+	node_at = (const Node*) p;
+	p += num_nodes * sizeof(Node);
+	x_at = (const double*) p;
+	p += num_slots * sizeof(double);
+	y_at = (const double*) p;
+	p += num_slots * sizeof(double);
+	id_at = (const long*) p;
+	p += num_slots * sizeof(long);
+	order_at = (const long*) p;
+	return true;
+}
+
+bool KdTree2D::Build(const double* x, const double* y, const long n)
+{
+	Clear();
+	if (n < 1) return false;
+	num_points = n;
+	nodes.reserve(2 * (n / (Bucket/2) + 1));
+	xs.reserve(n + n / 4 + 2);
+	ys.reserve(n + n / 4 + 2);
+	ids.reserve(n + n / 4 + 2);
+	order.reserve(n);
+	std::vector<long> idx(n);
+	for (long i= 0; i < n; ++i) idx[i] = i;
+	Split(&idx[0], n, x, y);
+	num_nodes = (long) nodes.size();
+	num_slots = (long) xs.size();
+	node_at = &nodes[0];
+	x_at = &xs[0];
+	y_at = &ys[0];
+	id_at = &ids[0];
+	order_at = &order[0];
+	return true;
+}
+
+/* builds the subtree of the n points idx, leaves left to right; returns
+ its root */
+long KdTree2D::Split(long* idx, const long n, const double* x,
+					 const double* y)
+{
+	const long node = (long) nodes.size();
+	nodes.push_back(Node());
+	long i;
+	if (n <= Bucket) {
+		Node leaf;
+		leaf.cut = 0;
+		leaf.axis = -1;
+		leaf.a = (long) xs.size();
+		for (i= 0; i < n + n % 2; ++i) {
+			// an odd leaf gets a point at infinity, which is never found
+			const long p = i < n ? idx[i] : -1;
+			xs.push_back(p >= 0 ? x[p] : HUGE_VAL);
+			ys.push_back(p >= 0 ? y[p] : HUGE_VAL);
+			ids.push_back(p);
+			if (p >= 0) order.push_back(p);
+		}
+		leaf.b = (long) xs.size();
+		nodes[node] = leaf;
+		return node;
+	}
+	double lo_x = x[idx[0]], hi_x = lo_x, lo_y = y[idx[0]], hi_y = lo_y;
+	for (i= 1; i < n; ++i) {
+		const double px = x[idx[i]], py = y[idx[i]];
+		if (px < lo_x) lo_x = px; else if (px > hi_x) hi_x = px;
+		if (py < lo_y) lo_y = py; else if (py > hi_y) hi_y = py;
+	}
+	Node split;
+	split.axis = hi_x - lo_x >= hi_y - lo_y ? 0 : 1;
+	const double* c = split.axis ? y : x;
+	const long mid = n / 2;
+	// points before mid are at or below the cut, the others at or above
+	std::nth_element(idx, idx + mid, idx + n, KdTree2DLess(c));
+	split.cut = c[idx[mid]];
+	split.a = Split(idx, mid, x, y);
+	split.b = Split(idx + mid, n - mid, x, y);
+	nodes[node] = split;
+	return node;
+}
+
+/* d2[s] = squared distance of (qx, qy) to slot leaf.a + s */
+void KdTree2D::Distances(const Node& leaf, const double qx, const double qy,
+						 double* d2) const
+{
+	const double* px = x_at + leaf.a;
+	const double* py = y_at + leaf.a;
+	const long n = leaf.b - leaf.a;
+#ifdef __SSE2__
+	const __m128d vx = _mm_set1_pd(qx), vy = _mm_set1_pd(qy);
+	for (long s= 0; s < n; s += 2) {
+		__m128d dx = _mm_sub_pd(_mm_loadu_pd(px + s), vx);
+		__m128d dy = _mm_sub_pd(_mm_loadu_pd(py + s), vy);
+		_mm_storeu_pd(d2 + s, _mm_add_pd(_mm_mul_pd(dx, dx),
+										 _mm_mul_pd(dy, dy)));
+	}
+#else
+	for (long s= 0; s < n; ++s) {
+		const double dx = px[s] - qx, dy = py[s] - qy;
+		d2[s] = dx*dx + dy*dy;
+	}
+#endif
+}
+
+int KdTree2D::Knn(const double qx, const double qy, int k, long* out_ids,
+				  double* out_d2) const
+{
+	if (k > num_points) k = (int) num_points;
+	if (k <= 0) return 0;
+	const double q[2] = { qx, qy };
+	double d2[Bucket + 1];
+	KdTree2DEntry stack[KdTree2DStack];
+	int sp = 0, found = 0;
+	stack[sp].node = 0;
+	stack[sp].off[0] = stack[sp].off[1] = 0;
+	++sp;
+	while (sp > 0) {
+		const KdTree2DEntry e = stack[--sp];
+		const double rd = e.off[0]*e.off[0] + e.off[1]*e.off[1];
+		if (found == k && rd > out_d2[k-1]) continue;
+		const Node& nd = node_at[e.node];
+		if (nd.axis >= 0) {
+			const double diff = q[nd.axis] - nd.cut;
+			KdTree2DEntry far = e;
+			far.node = diff < 0 ? nd.b : nd.a;
+			far.off[nd.axis] = diff;
+			stack[sp++] = far;
+			stack[sp] = e;
+			stack[sp++].node = diff < 0 ? nd.a : nd.b;
+			continue;
+		}
+		Distances(nd, qx, qy, d2);
+		for (long s= nd.a; s < nd.b; ++s) {
+			const long id = id_at[s];
+			const double d = d2[s - nd.a];
+			if (id < 0) continue;
+			if (found == k && (d > out_d2[k-1] ||
+							   (d == out_d2[k-1] && id > out_ids[k-1])))
+				continue;
+			// insert into the sorted list, dropping the last when full
+			int pos = found < k ? found++ : k-1;
+			while (pos > 0 && (out_d2[pos-1] > d ||
+							   (out_d2[pos-1] == d && out_ids[pos-1] > id))) {
+				out_d2[pos] = out_d2[pos-1];
+				out_ids[pos] = out_ids[pos-1];
+				--pos;
+			}
+			out_d2[pos] = d;
+			out_ids[pos] = id;
+		}
+	}
+	return found;
+}
+
+long KdTree2D::Radius(const double qx, const double qy, const double r,
+					  std::vector<long>& out_ids,
+					  std::vector<double>* out_d2) const
+{
+	if (num_points == 0 || r < 0) return 0;
+	const double q[2] = { qx, qy };
+	const double r2 = r*r;
+	double d2[Bucket + 1];
+	KdTree2DEntry stack[KdTree2DStack];
+	int sp = 0;
+	long found = 0;
+	stack[sp].node = 0;
+	stack[sp].off[0] = stack[sp].off[1] = 0;
+	++sp;
+	while (sp > 0) {
+		const KdTree2DEntry e = stack[--sp];
+		if (e.off[0]*e.off[0] + e.off[1]*e.off[1] > r2) continue;
+		const Node& nd = node_at[e.node];
+		if (nd.axis >= 0) {
+			const double diff = q[nd.axis] - nd.cut;
+			KdTree2DEntry far = e;
+			far.node = diff < 0 ? nd.b : nd.a;
+			far.off[nd.axis] = diff;
+			stack[sp++] = far;
+			stack[sp] = e;
+			stack[sp++].node = diff < 0 ? nd.a : nd.b;
+			continue;
+		}
+		Distances(nd, qx, qy, d2);
+		for (long s= nd.a; s < nd.b; ++s) {
+			if (id_at[s] < 0 || d2[s - nd.a] > r2) continue;
+			out_ids.push_back(id_at[s]);
+			if (out_d2) out_d2->push_back(d2[s - nd.a]);
+			++found;
+		}
+	}
+	return found;
+}
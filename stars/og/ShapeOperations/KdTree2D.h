@@ -0,0 +1,103 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_KD_TREE_2D_H__
+#define __GEODA_CENTER_KD_TREE_2D_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/*
+ KdTree2D
+ kd-tree of points in the plane, for the weights builders that only
+ need 2D Euclidean searches.  Cells are split at the median of their
+ wider side down to leaves of at most Bucket points.  The coordinates
+ are stored leaf by leaf in separate x and y arrays, each leaf padded to
+ an even length with points at infinity, so a leaf is scanned two points
+ at a time with SSE2 (plain loops elsewhere, with the same results).
+ Nodes are plain structs walked with an explicit stack that holds all
+ the state of a search: any number of threads can search one tree.
+ A tree can be saved to an index file and memory-mapped back, without
+ copying, by Load or Open.  The file is in the writer's byte order and
+ word sizes, and is keyed by a hash of the points it was built from: a
+ file for other points, or from another kind of machine, is rebuilt.
+ */
+class KdTree2D {
+public:
+	enum { Bucket = 8 };
+	KdTree2D();
+	virtual ~KdTree2D();
+
+	/** false for n < 1 */
+	bool Build(const double* x, const double* y, const long n);
+	/** the tree of the points from the index file fname when it was saved
+	 for the same points, else built and then saved there (an index that
+	 cannot be written is only a missed shortcut); false for n < 1 */
+	bool Open(const double* x, const double* y, const long n,
+			  const char* fname);
+	/** writes the index file fname, keyed by key, through a temporary
+	 file renamed over it; false when it cannot be written */
+	bool Save(const char* fname, const uint64_t key) const;
+	/** maps the index file fname; false, and empty, unless it is an
+	 index keyed by key */
+	bool Load(const char* fname, const uint64_t key);
+	void Clear();
+	/** hash of the points, coordinates bit for bit */
+	static uint64_t Key(const double* x, const double* y, const long n);
+
+	long Size() const { return num_points; }
+	/** point ids leaf by leaf; queries in this order walk the same nodes */
+	const long* Order() const { return order_at; }
+
+	/** the min(k, Size()) nearest points of (qx, qy), nearest first and
+	 ties by id, with their squared distances; returns how many */
+	int Knn(const double qx, const double qy, const int k, long* ids,
+			double* d2) const;
+	/** appends the points within distance r of (qx, qy), in tree order,
+	 and their squared distances when d2 is given; returns how many */
+	long Radius(const double qx, const double qy, const double r,
+				std::vector<long>& ids, std::vector<double>* d2= 0) const;
+
+private:
+	struct Node {
+		double cut;
+		int axis;      // 0 x, 1 y, -1 for a leaf
+		long a, b;     // children, or a leaf's slots [a, b)
+	};
+	long Split(long* idx, const long n, const double* x, const double* y);
+	void Distances(const Node& leaf, const double qx, const double qy,
+				   double* d2) const;
+	KdTree2D(const KdTree2D&);
+	KdTree2D& operator=(const KdTree2D&);
+
+	long num_points, num_nodes, num_slots;
+	std::vector<Node> nodes;     // root first
+	std::vector<double> xs, ys;  // leaf slots, padded
+	std::vector<long> ids;       // point of each slot, -1 for padding
+	std::vector<long> order;     // ids without the padding
+	// what the searches read: the vectors above or the mapped index file
+	const Node* node_at;
+	const double *x_at, *y_at;
+	const long *id_at, *order_at;
+	void* map;                   // the mapped index file, or NULL
+	size_t map_size;
+};
+
+#endif
@@ -0,0 +1,259 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include "../GenGeomAlgs.h"
+#include "../GenThreads.h"
+#include "../kNN/ANN.h"
+#include "KdTree2D.h"
+#include "KernelWeights.h"
+
+double KernelWeights::Kernel(int type, double z)
+{
+	switch (type) {
+		case triangular: return 1 - z;
+		case uniform: return 0.5;
+		case quadratic: return 0.75 * (1 - z*z);
+		case quartic: return (15.0/16.0) * (1 - z*z) * (1 - z*z);
+		case gaussian: return exp(-z*z / 2) / 2.5066282746310002; // 2 pi^.5
+		default: return 0;
+	}
+}
+
+/*
+ KernelWorker
+ Kernel rows for observations [from, to).  With kth_only set it only
+ records the distance to the k-th nearest neighbor of each row in kth.
+ Euclidean searches use the plane tree of x and y, arcs the ANN tree of
+ pts.  Rows are kept in counts/nbrs and copied into the GwtElement array
+ on the calling thread.
+ */
+class KernelWorker : public GenThread {
+public:
+	KernelWorker(const KdTree2D* plane, const double* x, const double* y,
+				 ANNkd_tree* tree, ANNpointArray pts, const long num_obs,
+				 const int kernel, const int k, const bool adaptive,
+				 const int diagonal, const int method, const double h,
+				 const bool kth_only, std::vector<double>& kth,
+				 const long first, const long last)
+	: counts(last-first, 0), plane(plane), x(x), y(y), tree(tree), pts(pts),
+	obs(num_obs), kernel(kernel), k(k), adaptive(adaptive),
+	diagonal(diagonal), method(method), h(h), kth_only(kth_only), kth(kth),
+	from(first), to(last) {}
+	std::vector<long> counts;
+	std::vector<GwtNeighbor> nbrs;
+protected:
+	void run();
+private:
+	int Search(long i, int kk);
+	int SearchRadius(long i, double r, int kk);
+	/* distance of the j-th point found, from its squared kd-tree distance */
+	double Dist(int j) const {
+		double d = sqrt(dists[j]);
+		return method == 2 ? GenGeomAlgs::ChordToArcDist(d) : d; }
+	const KdTree2D* plane;
+	const double *x, *y;
+	ANNkd_tree* tree;
+	ANNpointArray pts;
+	long obs;
+	int kernel, k;
+	bool adaptive;
+	int diagonal, method;
+	double h;
+	bool kth_only;
+	std::vector<double>& kth;
+	long from, to;
+	std::vector<long> nn_idx;
+	std::vector<ANNidx> ann_idx;
+	std::vector<double> dists;
+	std::vector<long> in_ids;  // Radius results, in tree order
+	std::vector<double> in_d2;
+	std::vector<std::pair<double, long> > near;
+};
+
+/* kk nearest neighbors of i, i itself included; returns kk */
+int KernelWorker::Search(long i, int kk)
+{
+	if (kk > obs) kk = (int) obs;
+	if ((int) nn_idx.size() < kk) {
+		nn_idx.resize(kk);
+		ann_idx.resize(kk);
+		dists.resize(kk);
+	}
+	if (plane) return plane->Knn(x[i], y[i], kk, &nn_idx[0], &dists[0]);
+	tree->annkSearch(pts[i], kk, &ann_idx[0], &dists[0]);
+	for (int j= 0; j < kk; ++j) nn_idx[j] = ann_idx[j];
+	return kk;
+}
+
+/* all points within kd-tree distance r of i (a chord for arcs), i itself
+ included, nearest first; returns their number */
+int KernelWorker::SearchRadius(long i, double r, int kk)
+{
+	if (plane) {
+		in_ids.clear();
+		in_d2.clear();
+		const int cnt = (int) plane->Radius(x[i], y[i], r, in_ids, &in_d2);
+		near.resize(cnt);
+		for (int j= 0; j < cnt; ++j)
+			near[j] = std::make_pair(in_d2[j], in_ids[j]);
+		std::sort(near.begin(), near.end());
+		if ((int) nn_idx.size() < cnt) {
+			nn_idx.resize(cnt);
+			dists.resize(cnt);
+		}
+		for (int j= 0; j < cnt; ++j) {
+			dists[j] = near[j].first;
+			nn_idx[j] = near[j].second;
+		}
+		return cnt;
+	}
+	for (;;) {
+		if ((int) ann_idx.size() < kk) {
+			nn_idx.resize(kk);
+			ann_idx.resize(kk);
+			dists.resize(kk);
+		}
+		int cnt = tree->annkFRSearch(pts[i], r*r, kk, &ann_idx[0], &dists[0]);
+		if (cnt <= kk) {
+			for (int j= 0; j < cnt; ++j) nn_idx[j] = ann_idx[j];
+			return cnt;
+		}
+		kk = cnt;
+	}
+}
+
+void KernelWorker::run()
+{
+	const double widen = 1.0000001;
+	int guess = k+1; // fixed bandwidth: start from the previous row's count
+	for (long i= from; i < to; ++i) {
+		int kk;
+		double hi = h;
+		if (kth_only || adaptive) {
+			kk = Search(i, k+1);
+			// distance of the k-th neighbor other than i
+			int seen = 0;
+			for (int j= 0; j < kk && seen < k; ++j) {
+				if (nn_idx[j] != i) { ++seen; hi = Dist(j); }
+			}
+			if (kth_only) { kth[i] = hi; continue; }
+			hi *= widen;
+		} else {
+			kk = SearchRadius(i, method == 2 ?
+							  GenGeomAlgs::ArcDistToChord(hi) * widen : hi, guess);
+		}
+		nbrs.push_back(GwtNeighbor(i, diagonal == KernelWeights::diag_one ?
+							1.0 : KernelWeights::Kernel(kernel, 0)));
+		long cnt = 1;
+		for (int j= 0; j < kk; ++j) {
+			if (nn_idx[j] == i) continue;
+			double d = Dist(j);
+			if (d > hi) break;
+			double z = hi > 0 ? d / hi : 0;
+			nbrs.push_back(GwtNeighbor(nn_idx[j],
+									   KernelWeights::Kernel(kernel, z)));
+			++cnt;
+			if (adaptive && cnt > k) break;
+		}
+		counts[i-from] = cnt;
+		if (!adaptive) guess = (int) (cnt + cnt/4 + 1);
+	}
+}
+
+static void RunKernelWorkers(std::vector<KernelWorker*>& workers)
+{
+	std::vector<GenThread*> threads(workers.begin(), workers.end());
+	GenThreads::RunAll(threads);
+}
+
+GwtElement* KernelGwt(const std::vector<double>& x,
+					  const std::vector<double>& y,
+					  int kernel, int k, double bandwidth, bool adaptive,
+					  int diagonal, int method, int nthreads,
+					  WeightsArena* arena)
+{
+	long obs = (long) x.size(), i;
+	if (obs < 2 || x.size() != y.size()) return NULL;
+	if (kernel < KernelWeights::triangular ||
+		kernel > KernelWeights::gaussian) return NULL;
+	if (k < 1 || k >= obs) {
+		if (adaptive || bandwidth <= 0) return NULL;
+		k = 1;
+	}
+	// arcs are searched with ANN as chords between points on the unit
+	// sphere, Euclidean distances with a KdTree2D
+	KdTree2D plane;
+	ANNpointArray data_pts = NULL;
+	ANNkd_tree* the_tree = NULL;
+	if (method == 2) {
+		data_pts = annAllocPts(obs, 3);
+		for (i= 0; i < obs; i++)
+			GenGeomAlgs::LonLatToUnit(x[i], y[i], data_pts[i]);
+		the_tree = new ANNkd_tree(data_pts, obs, 3);
+	} else {
+		plane.Build(&x[0], &y[0], obs);
+	}
+	const KdTree2D* pl = the_tree ? NULL : &plane;
+
+	int nt = GenThreads::NumThreads(obs, nthreads), t;
+	std::vector<double> kth;
+	std::vector<KernelWorker*> workers(nt);
+	double h = bandwidth;
+	if (!adaptive && h <= 0) {
+		// fixed bandwidth: the largest k-th nearest neighbor distance
+		kth.resize(obs);
+		for (t= 0; t < nt; t++) {
+			workers[t] = new KernelWorker(pl, &x[0], &y[0], the_tree, data_pts,
+				obs, kernel, k, adaptive, diagonal, method, 0, true, kth,
+				GenThreads::BlockBegin(obs, t, nt),
+				GenThreads::BlockBegin(obs, t+1, nt));
+		}
+		RunKernelWorkers(workers);
+		for (t= 0; t < nt; t++) delete workers[t];
+		h = 0;
+		for (i= 0; i < obs; i++) if (kth[i] > h) h = kth[i];
+		h *= 1.0000001;
+	}
+	for (t= 0; t < nt; t++) {
+		workers[t] = new KernelWorker(pl, &x[0], &y[0], the_tree, data_pts,
+			obs, kernel, k, adaptive, diagonal, method, h, false, kth,
+			GenThreads::BlockBegin(obs, t, nt),
+			GenThreads::BlockBegin(obs, t+1, nt));
+	}
+	RunKernelWorkers(workers);
+
+	GwtElement* gwt = new GwtElement[obs];
+	for (t= 0; t < nt; t++) {
+		KernelWorker* w = workers[t];
+		long row = GenThreads::BlockBegin(obs, t, nt), pos = 0;
+		for (size_t r= 0; r < w->counts.size(); r++, row++) {
+			if (gwt[row].alloc(w->counts[r], arena)) {
+				for (long j= 0; j < w->counts[r]; j++)
+					gwt[row].Push(w->nbrs[pos++]);
+			}
+		}
+		delete w;
+	}
+	if (the_tree) delete the_tree;
+	if (data_pts) annDeallocPts(data_pts);
+	return gwt;
+}
@@ -0,0 +1,61 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_KERNEL_WEIGHTS_H__
+#define __GEODA_CENTER_KERNEL_WEIGHTS_H__
+
+#include <vector>
+#include "GwtWeight.h"
+
+/*
+ Kernel weights w(i,j) = K(d(i,j) / h), z = d/h in [0, 1]:
+ triangular  1 - z
+ uniform     1/2
+ quadratic   3/4 (1 - z^2)
+ quartic     15/16 (1 - z^2)^2
+ gaussian    exp(-z^2 / 2) / sqrt(2 pi)
+ */
+namespace KernelWeights {
+	enum KernelType { triangular = 0, uniform = 1, quadratic = 2,
+		quartic = 3, gaussian = 4 };
+	/** weight of i on itself: K(0), or 1 as in GeoDa */
+	enum DiagonalType { diag_kernel = 0, diag_one = 1 };
+
+	double Kernel(int type, double z);
+}
+
+/*
+ Kernel weights from a single kd-tree of the points.  With adaptive,
+ the bandwidth of i is the distance to its k-th nearest neighbor and the
+ neighbors are those k.  Otherwise the bandwidth is the same for all,
+ bandwidth when it is positive or else the largest k-th nearest neighbor
+ distance, and the neighbors are all points within it.  Computed
+ bandwidths are widened by 1e-7 (relative) so the k-th neighbor keeps a
+ nonzero weight.  Every row starts with i itself, weighted as given by
+ diagonal, then the others nearest first.  method is the distance, 1
+ Euclidean (a KdTree2D) or 2 arc in miles (an ANN tree of chords between
+ points on the unit sphere).
+ */
+GwtElement* KernelGwt(const std::vector<double>& x,
+					  const std::vector<double>& y,
+					  int kernel, int k, double bandwidth, bool adaptive,
+					  int diagonal, int method, int nthreads= 0,
+					  WeightsArena* arena= 0);
+
+#endif
@@ -0,0 +1,136 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include "PackedRTree.h"
+
+static inline bool Overlap(const Box& a, const Box& b)
+{
+	return !(a.Bmax.x < b.Bmin.x || a.Bmin.x > b.Bmax.x ||
+			 a.Bmax.y < b.Bmin.y || a.Bmin.y > b.Bmax.y);
+}
+
+void PackedRTree::Build(const Box* boxes, const long n)
+{
+	num_items = n > 0 ? n : 0;
+	nodes.clear();
+	level_first.clear();
+	items.clear();
+	if (num_items == 0) return;
+
+	// STR order of the boxes
+	long i, cnt;
+	std::vector<std::pair<double, long> > key(num_items);
+	for (i= 0; i < num_items; ++i)
+		key[i] = std::make_pair(boxes[i].Bmin.x + boxes[i].Bmax.x, i);
+	std::sort(key.begin(), key.end());
+	const long leaves = (num_items + Fanout - 1) / Fanout;
+	const long slices = (long) ceil(sqrt((double) leaves));
+	const long per_slice = ((leaves + slices - 1) / slices) * Fanout;
+	for (long s= 0; s < num_items; s += per_slice) {
+		long e = s + per_slice < num_items ? s + per_slice : num_items;
+		for (i= s; i < e; ++i) {
+			const Box& b = boxes[key[i].second];
+			key[i].first = b.Bmin.y + b.Bmax.y;
+		}
+		std::sort(key.begin() + s, key.begin() + e);
+	}
+
+	items.resize(num_items);
+	nodes.reserve(num_items + num_items / (Fanout-1) + 1);
+	for (i= 0; i < num_items; ++i) {
+		items[i] = key[i].second;
+		nodes.push_back(boxes[items[i]]);
+	}
+	level_first.push_back(0);
+	level_first.push_back(num_items);
+	// each upper level bounds Fanout consecutive nodes of the one below
+	while (level_first.back() - level_first[level_first.size()-2] > 1) {
+		const long from = level_first[level_first.size()-2];
+		const long to = level_first.back();
+		for (i= from; i < to; i += Fanout) {
+			Box b(nodes[i]);
+			for (cnt= i+1; cnt < to && cnt < i + Fanout; ++cnt) b += nodes[cnt];
+			nodes.push_back(b);
+		}
+		level_first.push_back((long) nodes.size());
+	}
+}
+
+void PackedRTree::Search(const Box& q, std::vector<long>& hits) const
+{
+	if (num_items == 0) return;
+	int level = (int) level_first.size() - 2;
+	if (!Overlap(nodes[level_first[level]], q)) return;
+	if (level == 0) {
+		hits.push_back(items[0]);
+		return;
+	}
+	// nodes of level >= 1 that overlap q, depth first
+	std::pair<int, long> stack[64 * Fanout];
+	int top = 0;
+	stack[top++] = std::make_pair(level, 0L);
+	while (top > 0) {
+		level = stack[--top].first;
+		const long node = stack[top].second;
+		const long below = level_first[level-1];
+		const long size = level_first[level] - below;
+		const long first = node * Fanout;
+		const long last = first + Fanout < size ? first + Fanout : size;
+		if (level == 1) {
+			for (long child= first; child < last; ++child)
+				if (Overlap(nodes[below + child], q)) hits.push_back(items[child]);
+			continue;
+		}
+		// pushed last child first, so children are visited in order
+		for (long child= last-1; child >= first; --child)
+			if (Overlap(nodes[below + child], q))
+				stack[top++] = std::make_pair(level-1, child);
+	}
+}
+
+void PackedRTree::Pairs(std::vector<long>& a, std::vector<long>& b) const
+{
+	if (num_items > 1) Join((int) level_first.size() - 2, 0, 0, a, b);
+}
+
+/* pairs under nodes x <= y of level, which overlap */
+void PackedRTree::Join(const int level, const long x, const long y,
+					   std::vector<long>& a, std::vector<long>& b) const
+{
+	if (level == 0) {
+		if (x != y) {
+			a.push_back(items[x]);
+			b.push_back(items[y]);
+		}
+		return;
+	}
+	const long below = level_first[level-1];
+	const long size = level_first[level] - below;
+	const long x_last = (x+1) * Fanout < size ? (x+1) * Fanout : size;
+	const long y_last = (y+1) * Fanout < size ? (y+1) * Fanout : size;
+	for (long i= x * Fanout; i < x_last; ++i) {
+		const Box& bi = nodes[below + i];
+		for (long j= x == y ? i : y * Fanout; j < y_last; ++j) {
+			if (Overlap(bi, nodes[below + j])) Join(level-1, i, j, a, b);
+		}
+	}
+}
@@ -0,0 +1,63 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_PACKED_RTREE_H__
+#define __GEODA_CENTER_PACKED_RTREE_H__
+
+#include <vector>
+#include "Box.h"
+
+/*
+ PackedRTree
+ Static R-tree over a set of boxes, bulk loaded by sort-tile-recursive
+ (STR): the boxes are sorted by the x of their centers, cut into
+ vertical slices of about sqrt(n / Fanout) leaves, and each slice is
+ sorted by y and packed Fanout boxes to a leaf.  The upper levels group
+ Fanout consecutive nodes of the level below, so every node is full but
+ the last of its level.  All levels live in one array, leaves first, and
+ a node finds its children by index.  Unlike the PartitionM grid its
+ query cost does not depend on how uneven the box sizes are.
+ */
+class PackedRTree {
+public:
+	enum { Fanout = 16 };
+	PackedRTree() : num_items(0) {}
+
+	void Build(const Box* boxes, const long n);
+	long Size() const { return num_items; }
+	/** box ids in leaf order; neighboring ids are close in space */
+	long Item(const long pos) const { return items[pos]; }
+	/** appends to hits the ids of all boxes that intersect q (touching
+	 boxes included), in tree order */
+	void Search(const Box& q, std::vector<long>& hits) const;
+	/** every pair of intersecting boxes, once: a[i] before b[i] in leaf
+	 order.  Joins the tree with itself, node pairs that do not overlap
+	 are never opened. */
+	void Pairs(std::vector<long>& a, std::vector<long>& b) const;
+
+private:
+	void Join(const int level, const long x, const long y,
+			  std::vector<long>& a, std::vector<long>& b) const;
+	long num_items;
+	std::vector<Box> nodes;         // level by level, items first
+	std::vector<long> level_first;  // first node of each level, and the end
+	std::vector<long> items;        // id of each box of level 0
+};
+
+#endif
@@ -39,8 +39,8 @@ public:
 	virtual ~iShapeFile();
 	long Record() const { return record; }
 	long Recl(const long& shape);    // returns length of the record
-	iShapeFile& operator>>(long &v)  // reads 4 byte integer // MMM: big assumption!
-    { read((char*) &v, 4); return *this; }
+	iShapeFile& operator>>(long &v)  // reads 4 byte integer
+    { int i= 0; read((char*) &i, 4); v= i; return *this; }
 	iShapeFile& operator>>(int &v)  // reads 4 byte integer // MMM: big assumption!
     { read((char*) &v, 4); return *this; }
 	iShapeFile& operator>>(double &v)    // reads 8 byte float point
@@ -0,0 +1,129 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ Functions to combine spatial and temporal contiguity into space-time
+ contiguity.
+ */
+
+#include <algorithm>
+#include <vector>
+#include "../GenThreads.h"
+#include "SpaceTimeWeights.h"
+
+GalElement* TimeLagGal(long T, int n_past, int n_future)
+{
+	if (T < 1 || n_past < 0 || n_future < 0) return NULL;
+	GalElement* Wt = new GalElement[T];
+	for (long t= 0; t < T; ++t) {
+		long lo = t - n_past < 0 ? 0 : t - n_past;
+		long hi = t + n_future > T-1 ? T-1 : t + n_future;
+		if (hi - lo > 0 && Wt[t].alloc(hi - lo)) {
+			for (long s= lo; s <= hi; ++s) if (s != t) Wt[t].Push(s);
+		}
+	}
+	return Wt;
+}
+
+/*
+ SpaceTimeWorker
+ Fills the rows [from, to) of a space-time matrix whose offsets are
+ already known.
+ */
+class SpaceTimeWorker : public GenThread {
+public:
+	SpaceTimeWorker(const GalElement* ws, long num_obs, const GalElement* wt,
+					int st_type, GalCsr& st, long first, long last)
+	: Ws(ws), n(num_obs), Wt(wt), type(st_type), ST(st),
+	from(first), to(last) {}
+protected:
+	void run();
+private:
+	const GalElement* Ws;
+	long n;
+	const GalElement* Wt;
+	int type;
+	GalCsr& ST;
+	long from, to;
+};
+
+void SpaceTimeWorker::run()
+{
+	for (long node= from; node < to; ++node) {
+		long t = node / n, i = node % n;
+		long* out = &ST.nbrs[0] + ST.offsets[node];
+		long* begin = out;
+		const long* sp = Ws[i].dt();
+		long sp_sz = Ws[i].Size(), j;
+		if (type == SpaceTimeWeights::contemporaneous) {
+			for (j= 0; j < sp_sz; ++j) *out++ = t*n + sp[j];
+		} else {
+			const long* tm = Wt[t].dt();
+			for (long s= 0, sz= Wt[t].Size(); s < sz; ++s) {
+				long base = tm[s]*n;
+				if (type == SpaceTimeWeights::lagged) *out++ = base + i;
+				for (j= 0; j < sp_sz; ++j) *out++ = base + sp[j];
+			}
+		}
+		std::sort(begin, out);
+	}
+}
+
+/*
+ SpaceTimeContiguity
+ Builds the space-time matrix of the given type directly in CSR form.
+ Row sizes follow from Ws and Wt, so the offsets are computed first and
+ the rows are then filled in parallel, each thread writing its own block.
+ */
+bool SpaceTimeContiguity(const GalElement* Ws, long n,
+						 const GalElement* Wt, long T,
+						 int type, GalCsr& ST, int nthreads)
+{
+	if (Ws == NULL || n < 1 || T < 1) return false;
+	if (type != SpaceTimeWeights::contemporaneous && Wt == NULL) return false;
+	if (type < SpaceTimeWeights::contemporaneous ||
+		type > SpaceTimeWeights::kronecker) return false;
+
+	long nodes = n*T, node;
+	ST.offsets.resize(nodes+1);
+	ST.offsets[0] = 0;
+	for (node= 0; node < nodes; ++node) {
+		long t = node / n, i = node % n, sz;
+		if (type == SpaceTimeWeights::contemporaneous)
+			sz = Ws[i].Size();
+		else if (type == SpaceTimeWeights::lagged)
+			sz = Wt[t].Size() * (Ws[i].Size() + 1);
+		else
+			sz = Wt[t].Size() * Ws[i].Size();
+		ST.offsets[node+1] = ST.offsets[node] + sz;
+	}
+	ST.nbrs.resize(ST.offsets[nodes]);
+	if (ST.nbrs.empty()) return true;
+
+	int nt = GenThreads::NumThreads(nodes, nthreads), t;
+	std::vector<GenThread*> workers(nt);
+	for (t= 0; t < nt; ++t) {
+		workers[t] = new SpaceTimeWorker(Ws, n, Wt, type, ST,
+										 GenThreads::BlockBegin(nodes, t, nt),
+										 GenThreads::BlockBegin(nodes, t+1, nt));
+	}
+	GenThreads::RunAll(workers);
+	for (t= 0; t < nt; ++t) delete workers[t];
+	return true;
+}
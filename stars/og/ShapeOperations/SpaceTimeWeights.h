@@ -0,0 +1,46 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_SPACE_TIME_WEIGHTS_H__
+#define __GEODA_CENTER_SPACE_TIME_WEIGHTS_H__
+
+#include "GalWeight.h"
+
+/*
+ Space-time weights over n*T nodes: observation i in period t is node
+ t*n + i, so the nodes of one period are contiguous.  Ws holds the
+ spatial neighbors of the n units, Wt the temporal neighbors of the T
+ periods.  Node (i,t) is related to
+ contemporaneous  -- (j,t)  for j in Ws(i)
+ lagged           -- (j,s)  for s in Wt(t), j == i or j in Ws(i)
+ kronecker        -- (j,s)  for s in Wt(t), j in Ws(i)   (Wt x Ws)
+ */
+namespace SpaceTimeWeights {
+	enum SpaceTimeType { contemporaneous = 0, lagged = 1, kronecker = 2 };
+}
+
+/** temporal neighbors as created in TimeWeightsDlg: the n_past preceding
+ and the n_future following periods of each of the T periods */
+GalElement* TimeLagGal(long T, int n_past, int n_future);
+
+bool SpaceTimeContiguity(const GalElement* Ws, long n,
+						 const GalElement* Wt, long T,
+						 int type, GalCsr& ST, int nthreads= 0);
+
+#endif
@@ -0,0 +1,354 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdint.h>
+#include <utility>
+#include "../GenGeomAlgs.h"
+#include "../GenThreads.h"
+#include "ThresholdWeights.h"
+
+/*
+ PointGrid
+ Points bucketed in square or cubic cells of a given side, in 2 or 3
+ dimensions.  The cell coordinates are packed into one key, the last
+ coordinate fastest, so a cell and its neighbors along the last axis
+ have consecutive keys and their points sit next to each other in cell
+ order.  Only nonempty cells are kept, sorted by key.
+ */
+class PointGrid {
+public:
+	/** coords holds dim values per point; false for no points */
+	bool Build(const std::vector<double>& coords, const int dim,
+			   double side);
+	long Cells() const { return (long) keys.size(); }
+	/** points of cell at positions First(cell) .. First(cell+1)-1 */
+	long First(const long cell) const { return start[cell]; }
+	long Point(const long pos) const { return ids[pos]; }
+	/** position ranges [runs[r].first, runs[r].second) holding the
+	 points of cell and of every cell next to it */
+	void Neighbors(const long cell,
+				   std::vector<std::pair<long, long> >& runs) const;
+private:
+	int dim;
+	int64_t size[3];            // cells along each axis
+	std::vector<int64_t> keys;  // nonempty cells, ascending
+	std::vector<long> start;    // keys.size()+1 positions
+	std::vector<long> ids;      // point ids in cell order
+};
+
+bool PointGrid::Build(const std::vector<double>& coords, const int d,
+					  double side)
+{
+	dim = d;
+	const long n = (long) coords.size() / dim;
+	if (n < 1 || side <= 0) return false;
+	// at most 2^20 cells per axis, so keys fit in 60 bits; wider cells
+	// only cost more candidates
+	const double max_cells = 1048576.0;
+	double lo[3], hi[3];
+	int a;
+	for (a= 0; a < dim; ++a) lo[a] = hi[a] = coords[a];
+	for (long i= 1; i < n; ++i) {
+		for (a= 0; a < dim; ++a) {
+			const double c = coords[i*dim + a];
+			if (c < lo[a]) lo[a] = c;
+			else if (c > hi[a]) hi[a] = c;
+		}
+	}
+	for (a= 0; a < dim; ++a) {
+		if ((hi[a] - lo[a]) / side >= max_cells - 1)
+			side = (hi[a] - lo[a]) / (max_cells - 2);
+	}
+	for (a= 0; a < dim; ++a)
+		size[a] = (int64_t) floor((hi[a] - lo[a]) / side) + 1;
+
+	std::vector<std::pair<int64_t, long> > order(n);
+	for (long i= 0; i < n; ++i) {
+		int64_t key = 0;
+		for (a= 0; a < dim; ++a) {
+			int64_t c = (int64_t) floor((coords[i*dim + a] - lo[a]) / side);
+			if (c >= size[a]) c = size[a]-1;
+			key = key * size[a] + c;
+		}
+		order[i] = std::make_pair(key, i);
+	}
+	std::sort(order.begin(), order.end());
+	keys.clear();
+	start.clear();
+	ids.resize(n);
+	for (long pos= 0; pos < n; ++pos) {
+		if (pos == 0 || order[pos].first != keys.back()) {
+			keys.push_back(order[pos].first);
+			start.push_back(pos);
+		}
+		ids[pos] = order[pos].second;
+	}
+	start.push_back(n);
+	return true;
+}
+
+void PointGrid::Neighbors(const long cell,
+						  std::vector<std::pair<long, long> >& runs) const
+{
+	runs.clear();
+	int64_t c[3], key = keys[cell];
+	int a;
+	for (a= dim-1; a >= 0; --a) {
+		c[a] = key % size[a];
+		key /= size[a];
+	}
+	const int last = dim-1;
+	const int64_t from = c[last] > 0 ? c[last]-1 : 0;
+	const int64_t to = c[last] < size[last]-1 ? c[last]+1 : c[last];
+	// every combination of -1, 0, +1 on the axes before the last
+	int offs = 1;
+	for (a= 0; a < last; ++a) offs *= 3;
+	for (int o= 0; o < offs; ++o) {
+		int64_t base = 0;
+		int rest = o;
+		bool inside = true;
+		for (a= 0; a < last; ++a) {
+			const int64_t ca = c[a] + rest % 3 - 1;
+			rest /= 3;
+			if (ca < 0 || ca >= size[a]) { inside = false; break; }
+			base = base * size[a] + ca;
+		}
+		if (!inside) continue;
+		const int64_t key_lo = base * size[last] + from;
+		const int64_t key_hi = base * size[last] + to;
+		long k = (long) (std::lower_bound(keys.begin(), keys.end(), key_lo) -
+						 keys.begin());
+		long k_end = k;
+		while (k_end < Cells() && keys[k_end] <= key_hi) ++k_end;
+		if (k_end > k) runs.push_back(std::make_pair(start[k], start[k_end]));
+	}
+}
+
+/* i before j in the order nearest first, ties by id */
+static inline bool Nearer(const GwtNeighbor& i, const GwtNeighbor& j)
+{
+	return i.weight < j.weight || (i.weight == j.weight && i.nbx < j.nbx);
+}
+
+/*
+ ThresholdWorker
+ Takes cells in chunks from a shared counter.  With kth_only set it
+ records, for every point with more than cap neighbors, its cap-th
+ nearest neighbor in kth; otherwise it keeps the rows of its points
+ (the ids in rows) in nbrs, where row i starts at row_start[i] and has
+ counts[i] entries.  The rows are copied into the GwtElement array on
+ the calling thread.
+ */
+class ThresholdWorker : public GenThread {
+public:
+	static const long Chunk = 16;
+	ThresholdWorker(const PointGrid& grid, const std::vector<double>& x,
+					const std::vector<double>& y,
+					const std::vector<double>& sphere, const double threshold,
+					const double chord, const int method, const long cap,
+					const bool kth_only, std::vector<GwtNeighbor>& kth,
+					std::vector<long>& counts, std::vector<long>& row_start,
+					long& next, GenMutex& next_lock)
+	: grid(grid), x(x), y(y), sphere(sphere), threshold(threshold),
+	chord(chord), method(method), cap(cap), kth_only(kth_only), kth(kth),
+	counts(counts), row_start(row_start), next(next), next_lock(next_lock) {}
+	std::vector<long> rows;
+	std::vector<GwtNeighbor> nbrs;
+protected:
+	void run();
+private:
+	bool Within(const long i, const long j, double& d) const;
+	bool Keeps(const long i, const GwtNeighbor& j) const {
+		return kth[i].nbx < 0 || !Nearer(kth[i], j); }
+	const PointGrid& grid;
+	const std::vector<double>& x;
+	const std::vector<double>& y;
+	const std::vector<double>& sphere;
+	double threshold, chord;
+	int method;
+	long cap;
+	bool kth_only;
+	std::vector<GwtNeighbor>& kth;
+	std::vector<long>& counts;
+	std::vector<long>& row_start;
+	long& next;
+	GenMutex& next_lock;
+};
+
+/* d(i,j) <= threshold, worked out the same both ways */
+bool ThresholdWorker::Within(long i, long j, double& d) const
+{
+	if (x[i] == x[j] && y[i] == y[j]) {
+		d = threshold * 0.000001;  // identically located points
+		return true;
+	}
+	if (method == 2) {
+		// the chord between the points on the unit sphere grows with their
+		// arc distance, so only the neighbors need the arc
+		const double* p = &sphere[3*i];
+		const double* q = &sphere[3*j];
+		const double c = (p[0]-q[0])*(p[0]-q[0]) + (p[1]-q[1])*(p[1]-q[1]) +
+			(p[2]-q[2])*(p[2]-q[2]);
+		if (c > chord*chord) return false;
+		d = GenGeomAlgs::ChordToArcDist(sqrt(c));
+		return true;
+	}
+	const double dx = x[j] - x[i], dy = y[j] - y[i];
+	const double d2 = dx*dx + dy*dy;
+	if (d2 > threshold*threshold) return false;
+	d = sqrt(d2);
+	return true;
+}
+
+void ThresholdWorker::run()
+{
+	const long cells = grid.Cells();
+	std::vector<std::pair<long, long> > runs;
+	std::vector<GwtNeighbor> cand;
+	for (;;) {
+		long from, to;
+		{
+			GenMutex::Lock lock(next_lock);
+			from = next;
+			next = from + Chunk < cells ? from + Chunk : cells;
+			to = next;
+		}
+		if (from >= to) return;
+		for (long cell= from; cell < to; ++cell) {
+			grid.Neighbors(cell, runs);
+			for (long pos= grid.First(cell); pos < grid.First(cell+1); ++pos) {
+				const long i = grid.Point(pos);
+				if (kth_only) {
+					cand.clear();
+					for (size_t r= 0; r < runs.size(); ++r) {
+						for (long q= runs[r].first; q < runs[r].second; ++q) {
+							const long j = grid.Point(q);
+							double d;
+							if (j != i && Within(i, j, d))
+								cand.push_back(GwtNeighbor(j, d));
+						}
+					}
+					if ((long) cand.size() > cap) {
+						std::nth_element(cand.begin(), cand.begin() + (cap-1),
+										 cand.end(), Nearer);
+						kth[i] = cand[cap-1];
+					}
+					continue;
+				}
+				rows.push_back(i);
+				row_start[i] = (long) nbrs.size();
+				for (size_t r= 0; r < runs.size(); ++r) {
+					for (long q= runs[r].first; q < runs[r].second; ++q) {
+						const long j = grid.Point(q);
+						double d;
+						if (j == i || !Within(i, j, d)) continue;
+						if (cap > 0 && (!Keeps(i, GwtNeighbor(j, d)) ||
+										!Keeps(j, GwtNeighbor(i, d)))) continue;
+						nbrs.push_back(GwtNeighbor(j, d));
+					}
+				}
+				counts[i] = (long) nbrs.size() - row_start[i];
+			}
+		}
+	}
+}
+
+static void RunThresholdWorkers(std::vector<ThresholdWorker*>& workers)
+{
+	std::vector<GenThread*> threads(workers.begin(), workers.end());
+	GenThreads::RunAll(threads);
+}
+
+GwtElement* ThresholdGwt(const std::vector<double>& x,
+						 const std::vector<double>& y,
+						 double threshold, int degree, int method,
+						 int max_neighbors, int nthreads,
+						 WeightsArena* arena)
+{
+	long obs = (long) x.size(), i;
+	if (obs < 1 || x.size() != y.size() || !(threshold > 0)) return NULL;
+
+	PointGrid grid;
+	std::vector<double> sphere;
+	double chord = 0;
+	if (method == 2) {
+		sphere.resize(3*obs);
+		for (i= 0; i < obs; i++)
+			GenGeomAlgs::LonLatToUnit(x[i], y[i], &sphere[3*i]);
+		chord = GenGeomAlgs::ArcDistToChord(threshold);
+		if (!grid.Build(sphere, 3, chord * 1.000000001)) return NULL;
+	} else {
+		std::vector<double> plane(2*obs);
+		for (i= 0; i < obs; i++) {
+			plane[2*i] = x[i];
+			plane[2*i+1] = y[i];
+		}
+		if (!grid.Build(plane, 2, threshold * 1.000000001)) return NULL;
+	}
+
+	const long cap = max_neighbors > 0 ? max_neighbors : 0;
+	int nt = GenThreads::NumThreads(grid.Cells(), nthreads), t;
+	std::vector<GwtNeighbor> kth(obs, GwtNeighbor(-1));
+	std::vector<long> counts(obs, 0), row_start(obs, 0);
+	std::vector<ThresholdWorker*> workers(nt);
+	GenMutex next_lock;
+	long next;
+	if (cap > 0) {
+		next = 0;
+		for (t= 0; t < nt; t++) {
+			workers[t] = new ThresholdWorker(grid, x, y, sphere, threshold,
+				chord, method, cap, true, kth, counts, row_start, next,
+				next_lock);
+		}
+		RunThresholdWorkers(workers);
+		for (t= 0; t < nt; t++) delete workers[t];
+	}
+	next = 0;
+	for (t= 0; t < nt; t++) {
+		workers[t] = new ThresholdWorker(grid, x, y, sphere, threshold, chord,
+			method, cap, false, kth, counts, row_start, next, next_lock);
+	}
+	RunThresholdWorkers(workers);
+
+	double min = 1e10;
+	for (t= 0; t < nt; t++) {
+		const std::vector<GwtNeighbor>& nbrs = workers[t]->nbrs;
+		for (size_t pos= 0; pos < nbrs.size(); ++pos)
+			if (min > nbrs[pos].weight) min = nbrs[pos].weight;
+	}
+	GwtElement* gwt = new GwtElement[obs];
+	for (t= 0; t < nt; t++) {
+		ThresholdWorker* w = workers[t];
+		for (size_t r= 0; r < w->rows.size(); r++) {
+			const long row = w->rows[r];
+			if (!gwt[row].alloc(counts[row], arena)) continue;
+			for (long pos= row_start[row]; pos < row_start[row] + counts[row];
+				 ++pos) {
+				GwtNeighbor cx = w->nbrs[pos];
+				if (degree < 0) cx.weight = pow(cx.weight / min, degree);
+				else cx.weight = pow(cx.weight, degree);
+				gwt[row].Push(cx);
+			}
+		}
+		delete w;
+	}
+	return gwt;
+}
@@ -0,0 +1,49 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_THRESHOLD_WEIGHTS_H__
+#define __GEODA_CENTER_THRESHOLD_WEIGHTS_H__
+
+#include <vector>
+#include "GwtWeight.h"
+
+/*
+ Distance band weights: j is a neighbor of i when d(i,j) <= threshold,
+ with method 1 Euclidean and method 2 arc distance (miles, x longitude
+ and y latitude).  Weights are d(i,j) raised to degree, scaled by the
+ smallest distance for degree < 0, and coincident points are
+ threshold * 1e-6 apart, all as in shp2gwt.  Rows come out symmetric,
+ and the same for any number of threads (all processors when
+ nthreads <= 0).
+
+ The points are bucketed in cells of side threshold, and every point
+ only looks at the adjacent cells.  Arcs are bucketed and tested as
+ chords between points on the unit sphere, so only the neighbors need
+ trigonometry.
+ With max_neighbors > 0 each point keeps its max_neighbors nearest (ties
+ by id) and a pair stays only when each is among the other's nearest,
+ so no row grows past max_neighbors in dense areas.
+ */
+GwtElement* ThresholdGwt(const std::vector<double>& x,
+						 const std::vector<double>& y,
+						 double threshold, int degree, int method,
+						 int max_neighbors= 0, int nthreads= 0,
+						 WeightsArena* arena= 0);
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_WEIGHTS_ARENA_H__
+#define __GEODA_CENTER_WEIGHTS_ARENA_H__
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+/*
+ WeightsArena
+ Neighbor storage for one weights object carved out of a few large
+ blocks.  GalElement and GwtElement rows allocated from an arena do not
+ own their data: the arena releases everything at once when it is
+ destroyed, so it must outlive the element arrays that use it.
+ Blocks start at 1MB and double up to 64MB.  Like new, Alloc throws
+ std::bad_alloc when no block can be had; the arena is left unchanged.
+ */
+class WeightsArena {
+public:
+	WeightsArena() : cur(0), left(0), next_block(1 << 20), total(0) {}
+	virtual ~WeightsArena() {
+		for (size_t i=0; i<blocks.size(); i++) free(blocks[i]);
+		blocks.clear();
+	}
+
+	void* Alloc(size_t bytes) {
+		bytes = (bytes + 15) & ~(size_t) 15;
+		if (bytes > left) NewBlock(bytes);
+		void* p = cur;
+		cur += bytes;
+		left -= bytes;
+		total += bytes;
+		return p;
+	}
+	template <class T> T* Alloc(long n) {
+		if (n <= 0) return 0;
+		if ((size_t) n > ((size_t) -1 - 15) / sizeof(T)) throw std::bad_alloc();
+		return (T*) Alloc(n * sizeof(T)); }
+
+	size_t Bytes() const { return total; }
+	size_t Blocks() const { return blocks.size(); }
+
+private:
+	void NewBlock(size_t bytes) {
+		size_t sz = next_block > bytes ? next_block : bytes;
+		blocks.reserve(blocks.size() + 1); // push_back cannot throw below
+		char* block = (char*) malloc(sz);
+		if (!block) throw std::bad_alloc();
+		blocks.push_back(block);
+		if (next_block < ((size_t) 64 << 20)) next_block *= 2;
+		cur = block;
+		left = sz;
+	}
+	WeightsArena(const WeightsArena&);
+	WeightsArena& operator=(const WeightsArena&);
+
+	std::vector<char*> blocks;
+	char* cur;
+	size_t left;
+	size_t next_block;
+	size_t total;
+};
+
+#endif
@@ -0,0 +1,242 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <ctype.h>
+#include <string.h>
+#include "WeightsWriter.h"
+
+const char WeightsWriter::GalMagic[] = "GEODAGAL";
+const char WeightsWriter::GwtMagic[] = "GEODAGWT";
+const char WeightsWriter::GalExt[] = ".galb";
+const char WeightsWriter::GwtExt[] = ".gwtb";
+
+bool WeightsWriter::HasExt(const char* fname, const char* ext)
+{
+	if (!fname) return false;
+	const size_t n = strlen(fname), e = strlen(ext);
+	if (n < e) return false;
+	for (size_t i= 0; i < e; i++) {
+		if (tolower((unsigned char) fname[n-e+i]) != ext[i]) return false;
+	}
+	return true;
+}
+
+/* true on machines that store the low byte of a number first */
+static bool LittleEndian()
+{
+	const uint16_t one = 1;
+	return *(const unsigned char*) &one == 1;
+}
+
+/* the bytes of v, low byte first */
+static void ToLittle(uint64_t v, unsigned char* b, const int bytes)
+{
+	for (int i= 0; i < bytes; i++, v >>= 8) b[i] = (unsigned char) v;
+}
+
+WeightsWriter::WeightsWriter(const char* fname, const bool binary)
+: f(fname ? fopen(fname, binary ? "wb" : "w") : 0), ok(f != 0), used(0),
+buf(Block)
+{
+}
+
+bool WeightsWriter::Close()
+{
+	if (!f) return ok;
+	Flush();
+	if (fclose(f) != 0) ok = false;
+	f = 0;
+	return ok;
+}
+
+void WeightsWriter::Flush()
+{
+	if (used && f && fwrite(&buf[0], 1, used, f) != used) ok = false;
+	used = 0;
+}
+
+void WeightsWriter::PutInt(const int64_t v)
+{
+	char digits[24];
+	int n = 0;
+	uint64_t u = v < 0 ? (uint64_t) 0 - (uint64_t) v : (uint64_t) v;
+	do {
+		digits[n++] = (char) ('0' + u % 10);
+		u /= 10;
+	} while (u);
+	if (v < 0) Put('-');
+	while (n) Put(digits[--n]);
+}
+
+void WeightsWriter::PutWeight(const double w)
+{
+	char s[64];
+	int n = sprintf(s, "%18.9g", w);
+	if (used + n > (size_t) Block) Flush();
+	memcpy(&buf[used], s, n);
+	used += n;
+}
+
+void WeightsWriter::Write(const void* p, size_t bytes)
+{
+	const char* c = (const char*) p;
+	while (bytes) {
+		if (used == Block) Flush();
+		size_t n = Block - used < bytes ? Block - used : bytes;
+		memcpy(&buf[used], c, n);
+		used += n;
+		c += n;
+		bytes -= n;
+	}
+}
+
+void WeightsWriter::WriteInt32(const int32_t v)
+{
+	unsigned char b[4];
+	ToLittle((uint32_t) v, b, 4);
+	Write(b, 4);
+}
+
+void WeightsWriter::WriteInt64(const int64_t v)
+{
+	unsigned char b[8];
+	ToLittle((uint64_t) v, b, 8);
+	Write(b, 8);
+}
+
+void WeightsWriter::WriteDouble(const double v)
+{
+	uint64_t u;
+	memcpy(&u, &v, 8);
+	unsigned char b[8];
+	ToLittle(u, b, 8);
+	Write(b, 8);
+}
+
+void WeightsWriter::WriteHeader(const char* magic, const char* key,
+								const std::vector<int>& ids)
+{
+	Write(magic, 8);
+	WriteInt32(1);
+	WriteInt32((int32_t) ids.size());
+	const int32_t len = key ? (int32_t) strlen(key) : 0;
+	WriteInt32(len);
+	Write(key, len);
+	for (size_t i= 0; i < ids.size(); i++) WriteInt32(ids[i]);
+}
+
+bool WeightsBinary::Is(const char* fname, const char* magic)
+{
+	FILE* f = fopen(fname, "rb");
+	if (!f) return false;
+	char m[8];
+	bool is = fread(m, 1, 8, f) == 8 && memcmp(m, magic, 8) == 0;
+	fclose(f);
+	return is;
+}
+
+/* reads n little-endian values of T into v, from a file of size bytes */
+template <class T>
+static bool ReadArray(FILE* f, std::vector<T>& v, const int64_t n,
+					  const int64_t size)
+{
+	if (n < 0 || n > size / (int64_t) sizeof(T)) return false;
+	v.resize((size_t) n);
+	if (n && fread(&v[0], sizeof(T), (size_t) n, f) != (size_t) n) {
+		return false;
+	}
+	if (sizeof(T) > 1 && !LittleEndian()) {
+		for (size_t i= 0; i < v.size(); i++) {
+			unsigned char* b = (unsigned char*) &v[i];
+			std::reverse(b, b + sizeof(T));
+		}
+	}
+	return true;
+}
+
+/* reads one little-endian int32 */
+static bool ReadInt32(FILE* f, int32_t& v, const int64_t size)
+{
+	std::vector<int32_t> one;
+	if (!ReadArray(f, one, 1, size)) return false;
+	v = one[0];
+	return true;
+}
+
+bool WeightsBinary::Read(const char* fname, const char* magic)
+{
+	key.clear();
+	ids.clear(); start.clear(); nbrs.clear(); weights.clear();
+	FILE* f = fopen(fname, "rb");
+	if (!f) return false;
+	int64_t size = 0;
+	if (fseek(f, 0, SEEK_END) == 0) size = (int64_t) ftell(f);
+	rewind(f);
+	char m[8];
+	int32_t version = 0, n = -1, len = -1;
+	bool ok = fread(m, 1, 8, f) == 8 && memcmp(m, magic, 8) == 0 &&
+		ReadInt32(f, version, size) && version == 1 &&
+		ReadInt32(f, n, size) && n >= 0 &&
+		ReadInt32(f, len, size) && len >= 0;
+	if (ok) {
+		std::vector<char> k;
+		ok = ReadArray(f, k, len, size);
+		if (ok && len) key.assign(&k[0], len);
+	}
+	ok = ok && ReadArray(f, ids, n, size) &&
+		ReadArray(f, start, (int64_t) n + 1, size) && start[0] == 0;
+	for (int32_t i= 0; ok && i < n; i++) ok = start[i] <= start[i+1];
+	ok = ok && ReadArray(f, nbrs, start[n], size);
+	for (size_t j= 0; ok && j < nbrs.size(); j++) {
+		ok = nbrs[j] >= 0 && nbrs[j] < n;
+	}
+	if (ok && memcmp(magic, WeightsWriter::GwtMagic, 8) == 0) {
+		ok = ReadArray(f, weights, start[n], size);
+	}
+	// nothing may follow
+	ok = ok && fgetc(f) == EOF;
+	fclose(f);
+	return ok;
+}
+
+GalElement* WeightsBinary::ToGal() const
+{
+	const long n = (long) ids.size();
+	GalElement* gal = new GalElement[n];
+	for (long i= 0; i < n; i++) {
+		gal[i].alloc((int) (start[i+1] - start[i]));
+		for (int64_t j= start[i]; j < start[i+1]; j++) gal[i].Push(nbrs[j]);
+	}
+	return gal;
+}
+
+GwtElement* WeightsBinary::ToGwt() const
+{
+	const long n = (long) ids.size();
+	GwtElement* gwt = new GwtElement[n];
+	for (long i= 0; i < n; i++) {
+		gwt[i].alloc((int) (start[i+1] - start[i]));
+		for (int64_t j= start[i]; j < start[i+1]; j++) {
+			gwt[i].Push(GwtNeighbor(nbrs[j],
+									weights.empty() ? 0 : weights[j]));
+		}
+	}
+	return gwt;
+}
@@ -0,0 +1,117 @@
+/**
+ * OpenGeoDa TM, Copyright (C) 2011 by Luc Anselin - all rights reserved
+ *
+ * This file is part of OpenGeoDa.
+ *
+ * OpenGeoDa is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenGeoDa is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GEODA_CENTER_WEIGHTS_WRITER_H__
+#define __GEODA_CENTER_WEIGHTS_WRITER_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "GalWeight.h"
+#include "GwtWeight.h"
+
+/*
+ WeightsWriter
+ Output file for the .gal and .gwt writers.  Numbers are formatted
+ straight into a 1MB block, which is written out whenever it fills up,
+ instead of through an ofstream with a flush per line.  Text files
+ come out byte for byte as before (weights as %18.9g, i.e. setw(18)
+ with setprecision(9)).  Any failure, opening included, makes Close
+ return false.
+
+ Binary weights files are named *.galb or *.gwtb (GalExt, GwtExt), so
+ they are never taken for text files, and hold the same rows with every
+ number little-endian, whatever the byte order of the machine:
+	char[8]   GalMagic or GwtMagic
+	int32     1, the format version
+	int32     n, number of observations
+	int32     length of the key variable name, then its characters
+	int32     id[n]
+	int64     start[n+1]: row i is entries start[i] .. start[i+1]-1
+	int32     neighbor record numbers (0-based), start[n] of them
+	float64   the weight of each neighbor (GWT only)
+ WeightUtils::ReadGal and ReadGwt read them as well as text files; they
+ are for the C++ code only, as neither pysal nor the core Weight module
+ reads them.
+ */
+class WeightsWriter {
+public:
+	static const char GalMagic[];
+	static const char GwtMagic[];
+	static const char GalExt[];
+	static const char GwtExt[];
+	/** true when fname ends with ext, in any case */
+	static bool HasExt(const char* fname, const char* ext);
+
+	WeightsWriter(const char* fname, const bool binary= false);
+	virtual ~WeightsWriter() { Close(); }
+	bool IsOpen() const { return f != 0; }
+	/** writes out what is left; false if anything failed */
+	bool Close();
+
+	void Put(const char c) {
+		if (used == Block) Flush();
+		buf[used++] = c; }
+	void Put(const char* s) { while (*s) Put(*s++); }
+	void PutInt(const int64_t v);
+	void PutWeight(const double w);
+	/** raw bytes, for binary files */
+	void Write(const void* p, size_t bytes);
+	/** little-endian numbers, for binary files */
+	void WriteInt32(const int32_t v);
+	void WriteInt64(const int64_t v);
+	void WriteDouble(const double v);
+	/** the binary header, up to and including the ids */
+	void WriteHeader(const char* magic, const char* key,
+					 const std::vector<int>& ids);
+
+private:
+	enum { Block = 1 << 20 };
+	void Flush();
+	WeightsWriter(const WeightsWriter&);
+	WeightsWriter& operator=(const WeightsWriter&);
+
+	FILE* f;
+	bool ok;
+	size_t used;
+	std::vector<char> buf;
+};
+
+/*
+ WeightsBinary
+ The contents of a binary weights file (see WeightsWriter).
+ */
+class WeightsBinary {
+public:
+	std::string key;              // key variable name
+	std::vector<int> ids;         // id of each observation
+	std::vector<int64_t> start;   // ids.size()+1 row starts
+	std::vector<int> nbrs;        // neighbor record numbers
+	std::vector<double> weights;  // one per neighbor, GWT files only
+
+	/** true when fname starts with magic */
+	static bool Is(const char* fname, const char* magic);
+	/** false unless fname is a complete, consistent file with magic */
+	bool Read(const char* fname, const char* magic);
+	GalElement* ToGal() const;
+	GwtElement* ToGwt() const;
+};
+
+#endif
@@ -22,6 +22,7 @@
 #include "../logger.h"
 #include "../GenUtils.h"
 #include "../GeoDaConst.h"
+#include <set>
 #include <sstream>
 #include <string>
 
@@ -438,9 +439,50 @@ void PartitionP::remove(const int del)  {
  */
 PolygonPartition::~PolygonPartition()   {
 	if (nbrPoints)  {  delete [] nbrPoints;  nbrPoints= NULL;  };
+	if (view)  {  Points= NULL;  Parts= NULL;  };  // not ours to delete
 	return;
 }
 
+void PolygonPartition::View(const PolygonArena& arena, const long rec)
+{
+	if (!view)  {
+		if (Points) delete [] Points;
+		if (Parts) delete [] Parts;
+	}
+	view= true;
+	long first= arena.rec_point[rec], part= arena.rec_part[rec];
+	NumPoints= arena.rec_point[rec+1] - first;
+	NumParts= arena.rec_part[rec+1] - part;
+	Points= NumPoints ? const_cast<BasePoint*>(&arena.points[first]) : NULL;
+	Parts= NumParts ? const_cast<long*>(&arena.parts[part]) : NULL;
+	bBox= arena.boxes[rec];
+}
+
+bool PolygonArena::Load(iShapeFile& shp, const long* offsets,
+						const long records)
+{
+	points.clear();
+	parts.clear();
+	rec_point.assign(1, 0);
+	rec_part.assign(1, 0);
+	boxes.clear();
+	rec_point.reserve(records+1);
+	rec_part.reserve(records+1);
+	boxes.reserve(records);
+	PolygonPartition poly;
+	for (long rec= 0; rec < records; ++rec)  {
+		shp.seekg(offsets[rec]+12, ios::beg);
+		poly.ReadShape(shp);
+		if (!shp.good()) return false;
+		points.insert(points.end(), poly.Points, poly.Points + poly.NumPoints);
+		parts.insert(parts.end(), poly.Parts, poly.Parts + poly.NumParts);
+		rec_point.push_back((long) points.size());
+		rec_part.push_back((long) parts.size());
+		boxes.push_back(poly.bBox);
+	}
+	return true;
+}
+
 string getPointStr(const BasePoint& point)
 {
 	std::stringstream ss;
@@ -547,18 +589,97 @@ void PolygonPartition::MakeSmallPartition(const int mX, const double Start,
 	MakeNeighbors();
 }
 
+/** Length along which segments a0-a1 and b0-b1 overlap, when b lies on
+ the line through a within a tolerance relative to the coordinates.
+ */
+static double collinearOverlap(const BasePoint& a0, const BasePoint& a1,
+							   const BasePoint& b0, const BasePoint& b1)
+{
+	double ux= a1.x - a0.x, uy= a1.y - a0.y;
+	double len= sqrt(ux*ux + uy*uy);
+	if (len <= 0) return 0;
+	ux /= len;
+	uy /= len;
+	double tol= 1e-9 * (fabs(a0.x) + fabs(a0.y) + len);
+	double x0= b0.x - a0.x, y0= b0.y - a0.y;
+	double x1= b1.x - a0.x, y1= b1.y - a0.y;
+	if (fabs(ux*y0 - uy*x0) > tol || fabs(ux*y1 - uy*x1) > tol) return 0;
+	double t0= ux*x0 + uy*y0, t1= ux*x1 + uy*y1;
+	if (t0 > t1) std::swap(t0, t1);
+	double from= t0 > 0 ? t0 : 0, to= t1 < len ? t1 : len;
+	return to > from + tol ? to - from : 0;
+}
+
+/** Length of boundary shared by the host and guest edges that meet at
+ the coincident points host and guest.  Edges are named by the index of
+ their first point; the edges into and out of a point start at prev(pt)
+ and succ(pt)-1.  Collinear edges count for their overlap, so a guest
+ vertex lying on a host edge (a T-junction) is measured as well.  Each
+ pair of edges is measured once, the first time it is met; pairs in
+ measured are skipped.
+ */
+double PolygonPartition::sharedLength(const PolygonPartition &p,
+									  const int host, const int guest,
+									  std::set< std::pair<int, int> >& measured)
+	const
+{
+	const int hostEdge[2]= { prev(host), succ(host)-1 };
+	const int guestEdge[2]= { p.prev(guest), p.succ(guest)-1 };
+	double len= 0;
+	for (int i= 0; i < 2; ++i) {
+		for (int j= 0; j < 2; ++j) {
+			std::pair<int, int> key(hostEdge[i], guestEdge[j]);
+			if (measured.count(key)) continue;
+			double overlap= collinearOverlap(Points[hostEdge[i]],
+											 Points[hostEdge[i]+1],
+											 p.Points[guestEdge[j]],
+											 p.Points[guestEdge[j]+1]);
+			if (overlap > 0) {
+				len += overlap;
+				measured.insert(key);
+			}
+		}
+	}
+	return len;
+}
+
+/*
+ PolygonPartition::Perimeter
+ Total length of the rings of all parts.
+ */
+double PolygonPartition::Perimeter() const
+{
+	double len= 0;
+	for (long part= 0; part < NumParts; ++part) {
+		long last= (part+1 == NumParts) ? NumPoints : Parts[part+1];
+		for (long pt= Parts[part]; pt+1 < last; ++pt) {
+			double dx= Points[pt+1].x - Points[pt].x;
+			double dy= Points[pt+1].y - Points[pt].y;
+			len += sqrt(dx*dx + dy*dy);
+		}
+	}
+	return len;
+}
+
 /*
  PolygonPartition::sweep
  Determines if two polygons are neighbors. The host is assumed to be
  partitioned.
  Uses two criteria to establish neighborhood:
  0 -- common point;  1 -- common boundary.
+ When length is given, the sweep runs to the end and also returns the
+ length of the boundary the two polygons share (see sharedLength); a
+ positive length makes them rook neighbors even at a T-junction, and
+ queen neighbors touching at a point only are kept with length 0.
  */
-int PolygonPartition::sweep(PolygonPartition & guest, const int criteria)  
+int PolygonPartition::sweep(PolygonPartition & guest, const int criteria,
+							double* length)  
 {
-	int       host, dot, cly, cell;
+	int       host, dot, cly, cell, related= 0;
 	double    yStart= bBox._min().y, yStop= bBox._max().y;
 	BasePoint pt;
+	std::set< std::pair<int, int> > measured;
+	if (length) *length= 0;
 	guest.MakeSmallPartition(pX.Cells(), bBox._min().x, bBox._max().x);
 	for (cell= 0; cell < pX.Cells(); ++cell) {
 		for (host= pX.first(cell); host != GeoDaConst::EMPTY;
@@ -571,7 +692,15 @@ int PolygonPartition::sweep(PolygonPartition & guest, const int criteria)
 				for (host= pY.first(cly); host != GeoDaConst::EMPTY;
 					 host= pY.tail(host)) {
 					if (pt == Points[host]) {
-						if (criteria == 0 || edge(guest, host, dot)) { 
+						if (length) {
+							double len= sharedLength(guest, host, dot,
+													 measured);
+							*length += len;
+							if (!related)
+								related= criteria == 0 || len > 0 ||
+									edge(guest, host, dot);
+						}
+						else if (criteria == 0 || edge(guest, host, dot)) { 
 							pY.cleanup(pX, cell);  
 							return 1;  
 						}
@@ -581,7 +710,7 @@ int PolygonPartition::sweep(PolygonPartition & guest, const int criteria)
 		}
 		pY.cleanup(pX, cell);
 	}
-	return 0;
+	return related;
 }
 
 
@@ -29,6 +29,7 @@
 #include <fstream>
 #include <iostream>
 #include <iomanip>
+#include <set>
 #include <cmath>
 #include <vector>
 #include "AbstractShape.h"
@@ -213,10 +214,11 @@ class PartitionP : public BasePartition  {
     };
     int inTheRange(const double range) const  
 	{
-        if (range < 0 || range/step > cells) return -1;
+        if (range < 0) return -1;
         int where= (int) floor(range / step);
-        if (where < 0) where= 0;
-        else if (where >= cells) --where;
+        // range/step may round past cells for the top of the range
+        if (where > cells) return -1;
+        if (where == cells) --where;
         return where;
     }
     void remove(const int del);
@@ -227,15 +229,54 @@ class PartitionP : public BasePartition  {
 };
 
 
+class PolygonPartition;
+
+/**
+ PolygonArena
+ The vertices of every polygon of a shapefile, read once.  All points
+ live in one array: record rec has the points
+ points[rec_point[rec]] .. points[rec_point[rec+1]-1] and the parts
+ parts[rec_part[rec]] .. parts[rec_part[rec+1]-1], which are offsets
+ into its own points as in the file.
+ */
+class PolygonArena {
+public:
+	PolygonArena() : rec_point(1, 0), rec_part(1, 0) {}
+	/** reads the records at offsets (byte positions of the record
+	 headers); false if the file ends early */
+	bool Load(iShapeFile& shp, const long* offsets, const long records);
+	long Records() const { return (long) boxes.size(); }
+	long NumPoints(const long rec) const {
+		return rec_point[rec+1] - rec_point[rec]; }
+	const BasePoint* Points(const long rec) const {
+		return NumPoints(rec) ? &points[rec_point[rec]] : NULL; }
+	long NumParts(const long rec) const {
+		return rec_part[rec+1] - rec_part[rec]; }
+	const long* Parts(const long rec) const {
+		return NumParts(rec) ? &parts[rec_part[rec]] : NULL; }
+	size_t Bytes() const {
+		return points.size() * sizeof(BasePoint) +
+			(parts.size() + rec_point.size() + rec_part.size()) * sizeof(long) +
+			boxes.size() * sizeof(Box); }
+private:
+	friend class PolygonPartition;
+	std::vector<BasePoint> points;
+	std::vector<long> parts;
+	std::vector<long> rec_point, rec_part;
+	std::vector<Box> boxes;
+};
+
 /**
  PolygonPartition
  */
 class PolygonPartition : public PolygonShape
 {
+	friend class PolygonArena;
 	private :	
 	BasePartition       pX;
     PartitionP          pY;
     int *               nbrPoints;
+    bool                view;   // Points and Parts belong to a PolygonArena
     int prev(const int pt) const  
 	{
         int ix= nbrPoints[pt];
@@ -246,16 +287,31 @@ class PolygonPartition : public PolygonShape
         int ix= nbrPoints[pt];
         return (ix >= 0) ? ix : pt+1;
     }
+    // last point of a part, repeating its first point
+    bool closing(const int pt) const
+	{
+        int ix= nbrPoints[pt];
+        return ix >= 0 && ix != pt+1;
+    }
 	
 	public :	
-    PolygonPartition() : PolygonShape(), pX(), pY(), nbrPoints(NULL) {}
+    PolygonPartition() : PolygonShape(), pX(), pY(), nbrPoints(NULL),
+	view(false) {}
     ~PolygonPartition();
+    /** uses record rec of arena in place of ReadShape; arena must outlive
+	 this polygon */
+    void View(const PolygonArena& arena, const long rec);
     int MakePartition(int mX= 0, int mY= 0);
     void MakeSmallPartition(const int mX, const double Start,
 							const double Stop);
     void MakeNeighbors();
     bool edge(const PolygonPartition &p, const int host, const int guest);
-    int sweep(PolygonPartition & guest, const int criteria= 0);
+    int sweep(PolygonPartition & guest, const int criteria= 0,
+			  double* length= NULL);
+    double sharedLength(const PolygonPartition &p, const int host,
+						const int guest,
+						std::set< std::pair<int, int> >& measured) const;
+    double Perimeter() const;
 };
 
 /** BoundaryShape */
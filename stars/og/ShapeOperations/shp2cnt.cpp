@@ -31,7 +31,13 @@
 #include "../logger.h"
 #include "ShapeFileHdr.h"
 #include "ShapeFileTypes.h"
+#include "../GenThreads.h"
+#include "PackedRTree.h"
+#include "WeightsWriter.h"
 
+#include <algorithm>
+#include <string.h>
+#include <stdint.h>
 #include <string>
 using namespace std;
 
@@ -59,7 +65,7 @@ class PartitionM  {
 	
     void include(const int incl);
     void remove(const int del);
-    void initIx(const int incl, const double lwr, const double upr);
+    bool initIx(const int incl, const double lwr, const double upr);
     int lowest (const int el) const  {  return cellIndex [ el ];  };
     int upmost(const int el) const  {  return lastIndex [ el ];  };
     int first(const int cl) const  {  return cell[ cl ];  };
@@ -119,12 +125,12 @@ int PartitionM::Sum() const {
     return sum;
 };
 
-void PartitionM::initIx(const int incl, const double lwr, const double upr)  {
+bool PartitionM::initIx(const int incl, const double lwr, const double upr)  {
 	int lower= (int)floor(lwr/step), upper= (int)floor(upr/step);
 	if (lwr < 0 || upper > cells || incl < 0 || incl >= elements)  
 	{
 		//     cout << "PartM: incl= " << incl << " l= " << lwr << "  " << upr; 
-		exit(1);  
+		return false;
 	};
 	if (lower < 0) lower= 0;
     else if (lower >= cells) lower= cells-1;
@@ -132,7 +138,7 @@ void PartitionM::initIx(const int incl, const double lwr, const double upr)  {
     else if (upper < 0) upper= 0;
 	cellIndex [ incl ] = lower;
 	lastIndex [ incl ] = upper;
-	return;
+	return true;
 }
 
 /*
@@ -179,70 +185,81 @@ void PartitionM::remove(const int del)  {
 
 
 
-// # of records in the Shapefile == dimesion of the weights matrix
-static long         gRecords= 0;
-// locations of the polygon records in the shp file
-static long *       gOffset= NULL;
-// bounding boxes for each polygon
-static Box *        gBox= NULL;
-// bounding box for the entire map
-static Box          gBigBox;
-// partition constructed on lower(x) and upper(x) for each polygon
-static BasePartition  gMinX, gMaxX;
-// partition constructed on y for each polygon
-static PartitionM * gY;
+ContiguityBuilder::ContiguityBuilder()
+: records(0), offsets(0), boxes(0), big_box(new Box), min_x(0), max_x(0),
+y(0), rtree(0), polygons(0)
+{
+}
+
+ContiguityBuilder::~ContiguityBuilder()
+{
+	Close();
+	delete big_box;
+}
+
+void ContiguityBuilder::Close()
+{
+	if (y) delete y; y = 0;
+	if (rtree) delete rtree; rtree = 0;
+	if (min_x) delete min_x; min_x = 0;
+	if (max_x) delete max_x; max_x = 0;
+	if (polygons) delete polygons; polygons = 0;
+	if (offsets) delete [] offsets; offsets = 0;
+	if (boxes) delete [] boxes; boxes = 0;
+	records = 0;
+	fname.clear();
+}
+
+bool ContiguityBuilder::Fail(const char* msg)
+{
+	error = msg;
+	Close();
+	return false;
+}
 
-void ReadOffsets(const string& fname)  
+/* locations of the polygon records in the shp file, from the shx */
+bool ContiguityBuilder::ReadOffsets()
 {
 	iShapeFile    shx(fname, "shx");
+	if (!(shx.is_open() && shx.good())) return Fail("cannot open the shx file");
 	char          hs[ 2*GeoDaConst::ShpHeaderSize ];
 	shx.read((char *) &hs[0], 2*GeoDaConst::ShpHeaderSize);
+	if (!shx.good()) return Fail("cannot read the shx header");
 	ShapeFileHdr        hd(hs);
 	long          offset, contents;
-	gRecords= (hd.Length() - GeoDaConst::ShpHeaderSize) / 4;
-	gOffset= new long [ gRecords ];
+	records= (hd.Length() - GeoDaConst::ShpHeaderSize) / 4;
+	if (records <= 0) return Fail("the shapefile has no records");
+	offsets= new long [ records ];
 	
-	for (long rec= 0; rec < gRecords; ++rec)  
+	for (long rec= 0; rec < records; ++rec)  
 	{
 		offset= ReadBig(shx);
 		contents= ReadBig(shx);
 		offset *= 2;
-		gOffset[rec]= offset;
+		offsets[rec]= offset;
 	};
-	return;
-}
-
-bool IsLineShapeFile(const char* fname)
-{
-	string fn(fname);
-	iShapeFile   shp(fn, "shp");
-	char         hs[ 2*GeoDaConst::ShpHeaderSize ];
-	
-	shp.read(hs, 2 * GeoDaConst::ShpHeaderSize);
-	ShapeFileHdr       head(hs);
-	
-	shp.Recl(head.FileShape());
-	return (head.FileShape() == ShapeFileTypes::ARC);
+	if (!shx.good()) return Fail("the shx file is truncated");
+	return true;
 }
 
-void ReadBoxes(const string& fname)  
+/* bounding boxes of every polygon and of the entire map */
+bool ContiguityBuilder::ReadBoxes()
 {
 	iShapeFile   shp(fname, "shp");
+	if (!(shp.is_open() && shp.good())) return Fail("cannot open the shp file");
 	char          hs[ 2*GeoDaConst::ShpHeaderSize ];
 	shp.read(hs, 2*GeoDaConst::ShpHeaderSize);
+	if (!shp.good()) return Fail("cannot read the shp header");
 	ShapeFileHdr hd(hs);
 	if (ShapeFileTypes::ShapeType(hd.FileShape()) != ShapeFileTypes::POLYGON)  
 	{
-		//      cout << hs << endl;
-		//	  cout << hd.FileShape() << endl;
-		//      cout << " expecting POLYGON shape type " << endl;  
-		exit(1);  
+		return Fail("expecting a POLYGON shape type");
 	};
-	gBigBox= hd.BoundingBox();
+	*big_box= hd.BoundingBox();
 	
-	gBox= new Box [ gRecords ];
-	for (long rec= 0; rec < gRecords; ++rec)  {
-		shp.seekg(gOffset[rec]+12, ios::beg);
+	boxes= new Box [ records ];
+	for (long rec= 0; rec < records; ++rec)  {
+		shp.seekg(offsets[rec]+12, ios::beg);
 #ifdef WORDS_BIGENDIAN
 		char r[32], p;
 		double m1, m2, n1, n2;
@@ -269,13 +286,38 @@ void ReadBoxes(const string& fname)
 		memcpy(&n2, &r[24], sizeof(double));
 		BasePoint p1 = BasePoint(m1, m2);
 		BasePoint p2 = BasePoint(n1, n2);
-		gBox[rec] = Box(p1, p2);
+		boxes[rec] = Box(p1, p2);
 #else
-		shp >> gBox[rec];
+		shp >> boxes[rec];
 #endif
-		gBigBox += gBox[rec];                // make sure BigBox covers all boxes
+		*big_box += boxes[rec];              // make sure BigBox covers all boxes
 	};
-	return;
+	if (!shp.good()) return Fail("the shp file is truncated");
+	return true;
+}
+
+/* the vertices of all polygons, so the sweep never goes back to disk */
+bool ContiguityBuilder::ReadPolygons()
+{
+	iShapeFile   shp(fname, "shp");
+	if (!(shp.is_open() && shp.good())) return Fail("cannot open the shp file");
+	polygons= new PolygonArena;
+	if (!polygons->Load(shp, offsets, records))
+		return Fail("the shp file is truncated");
+	return true;
+}
+
+bool IsLineShapeFile(const char* fname)
+{
+	string fn(fname);
+	iShapeFile   shp(fn, "shp");
+	char         hs[ 2*GeoDaConst::ShpHeaderSize ];
+	
+	shp.read(hs, 2 * GeoDaConst::ShpHeaderSize);
+	ShapeFileHdr       head(hs);
+	
+	shp.Recl(head.FileShape());
+	return (head.FileShape() == ShapeFileTypes::ARC);
 }
 
 // tests if two boxes intersect each other
@@ -288,63 +330,168 @@ inline bool Intersect(const Box &a, const Box &b)
     return true;
 }
 
-GalElement* MakeContiguity(const string& fname, const int crit)  
+/*
+ ContiguityWorker
+ Runs the polygon sweeps of ContiguityBuilder::Half.  Hosts are taken in
+ chunks from a shared counter, so threads that draw large polygons do
+ not hold up the others; the outcome of candidate c goes to related[c]
+ (and length[c]), so no merging is needed afterwards.
+ */
+class ContiguityWorker : public GenThread {
+public:
+	static const long Chunk = 16;
+	ContiguityWorker(const PolygonArena& polygons, const int crit,
+					 const std::vector<long>& hosts,
+					 const std::vector<long>& first,
+					 const std::vector<long>& cands,
+					 std::vector<char>& related, double* length,
+					 double* perimeter, long& next, GenMutex& next_lock)
+	: polygons(polygons), crit(crit), hosts(hosts), first(first),
+	cands(cands), related(related), length(length), perimeter(perimeter),
+	next(next), next_lock(next_lock) {}
+protected:
+	void run();
+private:
+	const PolygonArena& polygons;
+	int crit;
+	const std::vector<long>& hosts;
+	const std::vector<long>& first;
+	const std::vector<long>& cands;
+	std::vector<char>& related;
+	double* length;
+	double* perimeter;
+	long& next;
+	GenMutex& next_lock;
+};
+
+void ContiguityWorker::run()
+{
+	const long num_hosts = (long) hosts.size();
+	for (;;) {
+		long from, to;
+		{
+			GenMutex::Lock lock(next_lock);
+			from = next;
+			next = from + Chunk < num_hosts ? from + Chunk : num_hosts;
+			to = next;
+		}
+		if (from >= to) return;
+		for (long h= from; h < to; ++h) {
+			const long curr = hosts[h];
+			PolygonPartition testPoly;
+			testPoly.View(polygons, curr);
+			testPoly.MakePartition();
+			if (perimeter) perimeter[curr]= testPoly.Perimeter();
+			for (long c= first[h]; c < first[h+1]; ++c) {
+				PolygonPartition nbrPoly;
+				nbrPoly.View(polygons, cands[c]);
+				// run sweep with testPoly as a host and nbrPoly as a guest
+				related[c] = (char) testPoly.sweep(nbrPoly, crit,
+												   length ? &length[c] : NULL);
+			}
+		}
+	}
+}
+
+/*
+ ContiguityBuilder::Half
+ Half contiguity matrix: each pair is reported by the polygon that is
+ swept first.  When bl is given, the shared boundary length of each pair
+ is stored in bl (same rows as the result) and the perimeter of each
+ polygon in perimeter.
+ The plane sweep over the x partition only collects the candidate pairs
+ whose boxes intersect, hosts in the order they leave the sweep; with
+ an R-tree hosts come in leaf order, each pair once.  The
+ polygon sweeps of those pairs run on nthreads threads (all processors
+ when nthreads <= 0), and the rows are then filled in candidate order,
+ so the result does not depend on the number of threads.  Every polygon
+ enters and leaves the y partition once, so the partition is empty
+ again afterwards.
+ */
+GalElement* ContiguityBuilder::Half(const int crit, WeightsArena* arena,
+									GwtElement* bl, double* perimeter,
+									int nthreads)
 {
 	int curr;
-	iShapeFile    shp(fname, "shp");
-	GalElement * gl= new GalElement [ gRecords ];
+	std::vector<long> hosts, first(1, 0), cands;
+	hosts.reserve(records);
+	first.reserve(records+1);
 	
-	if (!gl) return NULL;
-	OgSet   Neighbors(gRecords), Related(gRecords);
-	//  cout << "total steps= " << gMinX.Cells() << endl;
-	for (int step= 0; step < gMinX.Cells(); ++step) {
+	if (rtree) {
+		// hosts in leaf order, each pair a candidate of the one that
+		// comes first
+		std::vector<long> a, b, pos(records), at(records+1, 0);
+		long p;
+		size_t c;
+		rtree->Pairs(a, b);
+		for (p= 0; p < records; ++p) pos[rtree->Item(p)] = p;
+		for (c= 0; c < a.size(); ++c) ++at[pos[a[c]]+1];
+		for (p= 0; p < records; ++p) at[p+1] += at[p];
+		cands.resize(a.size());
+		first.assign(at.begin(), at.end());
+		for (c= 0; c < a.size(); ++c) cands[at[pos[a[c]]]++] = b[c];
+		for (p= 0; p < records; ++p) hosts.push_back(rtree->Item(p));
+	}
+	
+	OgSet   Neighbors(rtree ? 0 : records);
+	//  cout << "total steps= " << min_x->Cells() << endl;
+	for (int step= 0; !rtree && step < min_x->Cells(); ++step) {
 		// include all elements from xmin[step]
-		for (curr= gMinX.first(step); curr != GeoDaConst::EMPTY;
-			 curr= gMinX.tail(curr)) gY->include(curr);
+		for (curr= min_x->first(step); curr != GeoDaConst::EMPTY;
+			 curr= min_x->tail(curr)) y->include(curr);
 		
-		// test each element in xmax[step]
-		for (curr= gMaxX.first(step); curr != GeoDaConst::EMPTY;
-			 curr= gMaxX.tail(curr))  {
-			PolygonPartition testPoly;
-			shp.seekg(gOffset[curr]+12, ios::beg);
-			testPoly.ReadShape(shp); // load in the memory
-			testPoly.MakePartition();
-			
+		// collect the candidates of each element in xmax[step]
+		for (curr= max_x->first(step); curr != GeoDaConst::EMPTY;
+			 curr= max_x->tail(curr))  {
 			// form a list of neighbors
-			for (int cell=gY->lowest(curr); cell <= gY->upmost(curr); ++cell) {
-				int potential = gY->first( cell );
+			for (int cell=y->lowest(curr); cell <= y->upmost(curr); ++cell) {
+				int potential = y->first( cell );
 				while (potential != GeoDaConst::EMPTY) {
 					if (potential != curr) Neighbors.Push( potential );
-					potential = gY->tail(potential, cell);
+					potential = y->tail(potential, cell);
 				}
 			}
-			
-			// test each potential neighbor
 			for (int nbr = Neighbors.Pop(); nbr != GeoDaConst::EMPTY;
 				 nbr = Neighbors.Pop()) {
-				if (Intersect(gBox[curr], gBox[nbr])) {
-					PolygonPartition nbrPoly;
-					shp.seekg(gOffset[nbr]+12, ios::beg);
-					nbrPoly.ReadShape(shp);
-					
-					if (curr == 0 && nbr == 0) {
-						
-					}
-					
-					// run sweep with testPoly as a host and nbrPoly as a guest
-					int related = testPoly.sweep(nbrPoly, crit);
-					if (related) Related.Push(nbr);
-				}
+				if (Intersect(boxes[curr], boxes[nbr])) cands.push_back(nbr);
 			}
+			hosts.push_back(curr);
+			first.push_back((long) cands.size());
 			
-			if (Related.Size() && gl[curr].alloc(Related.Size())) {
-				while (Related.Size()) gl[curr].Push(Related.Pop());
-			}
-			
-			gY->remove(curr);       // remove from the partition
+			y->remove(curr);        // remove from the partition
 		}
 	}
 	
+	std::vector<char> related(cands.size(), 0);
+	std::vector<double> length(bl ? cands.size() : 0, 0);
+	double* plength = length.empty() ? NULL : &length[0];
+	long next = 0;
+	GenMutex next_lock;
+	int nt = GenThreads::NumThreads((long) hosts.size(), nthreads), t;
+	std::vector<GenThread*> workers(nt);
+	for (t= 0; t < nt; ++t)
+		workers[t] = new ContiguityWorker(*polygons, crit, hosts, first, cands,
+										  related, plength, perimeter, next,
+										  next_lock);
+	GenThreads::RunAll(workers);
+	for (t= 0; t < nt; ++t) delete workers[t];
+	
+	GalElement * gl= new GalElement [ records ];
+	for (size_t h= 0; h < hosts.size(); ++h) {
+		curr = (int) hosts[h];
+		long cnt = 0, c;
+		for (c= first[h]; c < first[h+1]; ++c) if (related[c]) ++cnt;
+		if (cnt == 0) continue;
+		if (bl && bl[curr].alloc((int) cnt)) {
+			for (c= first[h]; c < first[h+1]; ++c)
+				if (related[c]) bl[curr].Push(GwtNeighbor(cands[c], length[c]));
+		}
+		// latest candidate first, as the serial sweep popped them
+		if (gl[curr].alloc(cnt, arena)) {
+			for (c= first[h+1]-1; c >= first[h]; --c)
+				if (related[c]) gl[curr].Push(cands[c]);
+		}
+	}
 	return gl;
 }
 
@@ -395,25 +542,27 @@ inline double ReadD(ifstream &in)
 
 
 
-GalElement * MakeFull(GalElement *half)  
+/* symmetric matrix from the half matrix, rows sorted */
+GalElement * ContiguityBuilder::MakeFull(GalElement *half,
+										 WeightsArena* arena) const
 {
-    long * Count= new long [ gRecords ], nbr, cnt;
-    for (cnt= 0; cnt < gRecords; ++cnt)
+    long * Count= new long [ records ], nbr, cnt;
+    for (cnt= 0; cnt < records; ++cnt)
 		Count[ cnt ]= half[cnt].Size();
-    for (cnt= 0; cnt < gRecords; ++cnt)
+    for (cnt= 0; cnt < records; ++cnt)
         for (nbr= half[cnt].Size()-1; nbr >= 0; --nbr)
 			++Count [ half[cnt].elt(nbr) ];
-    GalElement * full= new GalElement [ gRecords ];
+    GalElement * full= new GalElement [ records ];
 	
-    for (cnt= 0; cnt < gRecords; ++cnt)
-		full[cnt].alloc( Count[cnt] );
-    for (cnt= 0; cnt < gRecords; ++cnt)
+    for (cnt= 0; cnt < records; ++cnt)
+		full[cnt].alloc( Count[cnt], arena );
+    for (cnt= 0; cnt < records; ++cnt)
 		for (nbr= half[cnt].Size()-1; nbr >= 0; --nbr)  {
 			long val= half[cnt].elt(nbr);
 			full[cnt].Push(val);
 			full[val].Push(cnt);
 		};
-    for (cnt= 0; cnt < gRecords; ++cnt)  {
+    for (cnt= 0; cnt < records; ++cnt)  {
 		if (full[cnt].Size() > 1)
 			ValueSort(full[cnt].dt(), 0, full[cnt].Size()-1);
     };
@@ -436,137 +585,605 @@ bool SaveGal(const GalElement *full,
 	
 	int Obs = (int) id_vec.size();
 	
-	ofstream out(ofname);
+	WeightsWriter out(ofname);
+	if (!out.IsOpen()) return false;
 	
 	string fn(ofname);
 	string local = GenUtils::GetTheFileTitle(fn);
 	LOG_MSG(local);
 	
-	out << "0 " << Obs << " " << local.c_str();
-	out << " " << vname << endl;
+	out.Put("0 ");
+	out.PutInt(Obs);
+	if (vname[0]) { // else record order
+		out.Put(' ');
+		out.Put(local.c_str());
+		out.Put(' ');
+		out.Put(vname);
+	}
+	out.Put('\n');
 	
 	for (int cnt= 0; cnt < Obs; ++cnt) {
-		out << id_vec[cnt];
-		out << " " << full[cnt].Size() << endl;
+		out.PutInt(id_vec[cnt]);
+		out.Put(' ');
+		out.PutInt(full[cnt].Size());
+		out.Put('\n');
 		for (int cp= full[cnt].Size(); --cp >= 0;) {
-			out << id_vec[full[cnt].elt(cp)];			
-			if (cp > 0) out << " ";
+			out.PutInt(id_vec[full[cnt].elt(cp)]);
+			if (cp > 0) out.Put(' ');
 		}
-		out << endl;
+		out.Put('\n');
 	}
 
 	LOG_MSG("Exiting SaveGal, (5 args)");
-	return true;
+	return out.Close();
 }
 
-GalElement* shp2gal(const char* fname, int criteria, bool save)  
+bool SaveGal(const GalCsr& full,
+			 const char* ofname,
+			 const char* vname,
+			 const std::vector<int>& id_vec)
 {
-	string fn(fname);
-	GalElement * full;
-	ReadOffsets(fn);
-	ReadBoxes(fn);
-	
-	long gx, gy, cnt, total=0;
-	gx= gRecords / 8 + 2;
-	
-	gMinX.alloc(gRecords, gx, gBigBox._max().x - gBigBox._min().x );
-	gMaxX.alloc(gRecords, gx, gBigBox._max().x - gBigBox._min().x );
-	for (cnt= 0; cnt < gRecords; ++cnt) {
-		gMinX.include( cnt, gBox[cnt]._min().x - gBigBox._min().x );
-		gMaxX.include( cnt, gBox[cnt]._max().x - gBigBox._min().x );
+	if (ofname == NULL || vname == NULL || id_vec.size() == 0 ||
+		full.NumObs() != (long) id_vec.size()) {
+		return false;
 	}
-	
-	gy= (int)(sqrt((long double)gRecords) + 2);
-	do {
-		gY= new PartitionM(gRecords, gy, gBigBox._max().y - gBigBox._min().y );
-		for (cnt= 0; cnt < gRecords; ++cnt)
-			gY->initIx( cnt, gBox[cnt]._min().y - gBigBox._min().y, 
-					   gBox[cnt]._max().y - gBigBox._min().y );
-		total= gY->Sum();
-		if (total > gRecords * 8) {
-			delete gY;
-			gy = gy/2 + 1;
-			total= 0;
+
+	int Obs = (int) id_vec.size();
+
+	WeightsWriter out(ofname);
+	if (!out.IsOpen()) return false;
+
+	string fn(ofname);
+	string local = GenUtils::GetTheFileTitle(fn);
+
+	out.Put("0 ");
+	out.PutInt(Obs);
+	if (vname[0]) { // else record order
+		out.Put(' ');
+		out.Put(local.c_str());
+		out.Put(' ');
+		out.Put(vname);
+	}
+	out.Put('\n');
+
+	for (int cnt= 0; cnt < Obs; ++cnt) {
+		long sz = full.Size(cnt);
+		const long* nb = full.dt(cnt);
+		out.PutInt(id_vec[cnt]);
+		out.Put(' ');
+		out.PutInt(sz);
+		out.Put('\n');
+		for (long cp= 0; cp < sz; ++cp) {
+			out.PutInt(id_vec[nb[cp]]);
+			if (cp+1 < sz) out.Put(' ');
 		}
-	} while ( total == 0);
-	
-	GalElement * gl= MakeContiguity(fn, criteria);
-	
-	if (gY) delete gY; gY = 0;
-	if (gOffset) delete [] gOffset; gOffset = 0;
-	if (gBox) delete [] gBox; gBox = 0;
+		out.Put('\n');
+	}
+	return out.Close();
+}
+
+bool SaveGalBinary(const GalElement *full,
+				   const char* ofname,
+				   const char* vname,
+				   const std::vector<int>& id_vec)
+{
+	if (full == NULL || id_vec.size() == 0 ||
+		!WeightsWriter::HasExt(ofname, WeightsWriter::GalExt)) {
+		return false;
+	}
+	long Obs = (long) id_vec.size(), cnt, cp;
+	WeightsWriter out(ofname, true);
+	if (!out.IsOpen()) return false;
+	out.WriteHeader(WeightsWriter::GalMagic, vname, id_vec);
+	int64_t start = 0;
+	out.WriteInt64(start);
+	for (cnt= 0; cnt < Obs; ++cnt) out.WriteInt64(start += full[cnt].Size());
+	for (cnt= 0; cnt < Obs; ++cnt) {
+		for (cp= 0; cp < full[cnt].Size(); ++cp) {
+			out.WriteInt32((int32_t) full[cnt].elt(cp));
+		}
+	}
+	return out.Close();
+}
+
+bool SaveGalBinary(const GalCsr& full,
+				   const char* ofname,
+				   const char* vname,
+				   const std::vector<int>& id_vec)
+{
+	if (id_vec.size() == 0 || full.NumObs() != (long) id_vec.size() ||
+		!WeightsWriter::HasExt(ofname, WeightsWriter::GalExt)) {
+		return false;
+	}
+	long Obs = (long) id_vec.size(), cnt, cp;
+	WeightsWriter out(ofname, true);
+	if (!out.IsOpen()) return false;
+	out.WriteHeader(WeightsWriter::GalMagic, vname, id_vec);
+	for (cnt= 0; cnt <= Obs; ++cnt) out.WriteInt64(full.offsets[cnt]);
+	for (cp= 0; cp < full.NumNbrs(); ++cp) {
+		out.WriteInt32((int32_t) full.nbrs[cp]);
+	}
+	return out.Close();
+}
+
+/*
+ ContiguityBuilder::Open
+ Reads the bounding boxes of fname and builds the index that Gal and
+ BoundaryLength take the candidate pairs from: the x and y partitions
+ of the plane sweep, or a packed R-tree.  The partitions are sized for
+ boxes of similar size; with index automatic the R-tree is used when
+ the boxes are too uneven for the first y partition (it would hold more
+ than 8 entries per polygon).
+ */
+bool ContiguityBuilder::Open(const char* shp_fname, int index)
+{
+	Close();
+	error.clear();
+	if (!shp_fname) return Fail("no shapefile given");
+	fname = shp_fname;
+	if (!ReadOffsets() || !ReadBoxes() || !ReadPolygons()) return false;
 	
-	full = MakeFull(gl);
+	long gx, gy, cnt, total=0;
+	if (index != rtree_index) {
+		gx= records / 8 + 2;
+		const Box& big = *big_box;
+		
+		min_x= new BasePartition;
+		max_x= new BasePartition;
+		min_x->alloc(records, gx, big._max().x - big._min().x );
+		max_x->alloc(records, gx, big._max().x - big._min().x );
+		for (cnt= 0; cnt < records; ++cnt) {
+			min_x->include( cnt, boxes[cnt]._min().x - big._min().x );
+			max_x->include( cnt, boxes[cnt]._max().x - big._min().x );
+		}
+		
+		gy= (int)(sqrt((long double)records) + 2);
+		do {
+			y= new PartitionM(records, gy, big._max().y - big._min().y );
+			for (cnt= 0; cnt < records; ++cnt) {
+				if (!y->initIx( cnt, boxes[cnt]._min().y - big._min().y, 
+								boxes[cnt]._max().y - big._min().y ))
+					return Fail("a record lies outside the map bounding box");
+			}
+			total= y->Sum();
+			if (total > records * 8) {
+				delete y;
+				y = 0;
+				if (index == automatic_index) break;
+				gy = gy/2 + 1;
+				total= 0;
+			}
+		} while ( total == 0);
+		if (y) return true;
+		delete min_x; min_x = 0;
+		delete max_x; max_x = 0;
+	}
+	rtree= new PackedRTree;
+	rtree->Build(boxes, records);
+	return true;
+}
+
+GalElement* ContiguityBuilder::Gal(int criteria, WeightsArena* arena,
+									int nthreads)
+{
+	if (!polygons) {
+		if (error.empty()) error = "no shapefile open";
+		return NULL;
+	}
+	// the half matrix is scratch: give it its own arena
+	WeightsArena* half_arena = arena ? new WeightsArena : 0;
+	GalElement * gl= Half(criteria, half_arena, NULL, NULL, nthreads);
+	GalElement * full= gl ? MakeFull(gl, arena) : 0;
 	if (gl) delete [] gl; gl = 0;
+	if (half_arena) delete half_arena; half_arena = 0;
 	return full;
 }
 
-// Lag: True; otherwise Cumulative
-GalElement *HOContiguity(const int p, long obs, GalElement *W, bool Lag)
+GwtElement* ContiguityBuilder::BoundaryLength(int criteria,
+											  bool perimeter_share,
+											  WeightsArena* arena,
+											  int nthreads)
 {
-	
-	if (obs	< 1 || p <= 1 || p > obs-1) return NULL;
-	
-	int j, QueueCnt, c, irow, CurrIx, LastIx;
-	int* nLag				= new int [p];
-	GalElement *HO	= new GalElement[obs];
-	long *Queue			= new long [obs];
-	long *dt;
-	int *OC					= new int [obs];
-	
-	if (W == NULL || nLag == NULL || HO == NULL ||
-		Queue == NULL || OC == NULL) return NULL;
-	
-	for (j=0; j < obs; j++) OC[j] = 0;
-	for (irow = 0; irow < obs; irow++) {
-		OC[irow] = -1;
-		dt = W[irow].dt(); // neighbors of irow
-		QueueCnt = W[irow].Size();
-		for (j=0; j<QueueCnt; j++) {
-			Queue[j] = dt[j];
-			OC[Queue[j]] = 1;
+	if (!polygons) {
+		if (error.empty()) error = "no shapefile open";
+		return NULL;
+	}
+	long obs = records;
+	GwtElement* half = new GwtElement[obs];
+	std::vector<double> perimeter(obs, 0);
+	GalElement* gl = Half(criteria, NULL, half, &perimeter[0], nthreads);
+	if (!gl) {
+		delete [] half;
+		return NULL;
+	}
+	delete [] gl;
+	gl = 0;
+
+	GwtElement* full = MakeFullGwt(half, obs, 1, false, arena);
+	delete [] half;
+	half = 0;
+	if (full && perimeter_share) {
+		for (long cnt= 0; cnt < obs; ++cnt) {
+			if (perimeter[cnt] <= 0) continue;
+			for (long nbr= 0; nbr < full[cnt].Size(); ++nbr)
+				full[cnt].dt()[nbr].weight /= perimeter[cnt];
+		}
+	}
+	return full;
+}
+
+/*
+ KeyTable
+ Open addressing hash table that numbers pairs of 64-bit keys 0, 1, ...
+ in order of first insertion.  The table doubles whenever it gets half
+ full.
+ */
+class KeyTable {
+public:
+	KeyTable(const size_t expected) : mask(15) {
+		while (mask+1 < 2*expected) mask = 2*mask + 1;
+		slots.assign(mask+1, -1);
+		keys.reserve(2*expected);
+	}
+	long Id(const int64_t a, const int64_t b) {
+		for (size_t slot = Slot(a, b);; slot = (slot + 1) & mask) {
+			long id = slots[slot];
+			if (id < 0) {
+				id = Size();
+				slots[slot] = id;
+				keys.push_back(a);
+				keys.push_back(b);
+				if ((size_t) Size() * 2 > mask) Grow();
+				return id;
+			}
+			if (keys[2*id] == a && keys[2*id+1] == b) return id;
 		}
-		CurrIx = 0; int k;
-		k= LastIx = QueueCnt;
-		for (c=2;c<=p; c++) {
-			nLag[c-2] = 0;
-			LastIx = k;
-			for (;CurrIx <LastIx; CurrIx++) {
-				dt = W[Queue[CurrIx]].dt();
-				int Nbrs = W[Queue[CurrIx]].Size();
-				for ( j=0; j< Nbrs; j++) {
-					if (OC[dt[j]] == 0) {
-						OC[dt[j]] = c;
-						Queue[k] = dt[j];
-						k++;
-						nLag[c-2]++;
+	}
+	/** the id of (a, b), or -1 when it was never numbered */
+	long Find(const int64_t a, const int64_t b) const {
+		for (size_t slot = Slot(a, b);; slot = (slot + 1) & mask) {
+			long id = slots[slot];
+			if (id < 0) return -1;
+			if (keys[2*id] == a && keys[2*id+1] == b) return id;
+		}
+	}
+	long Size() const { return (long) keys.size() / 2; }
+private:
+	size_t Slot(const int64_t a, const int64_t b) const {
+		uint64_t h = (uint64_t) a * 0x9E3779B97F4A7C15ULL;
+		h ^= ((uint64_t) b + (h << 6) + (h >> 2)) * 0xC2B2AE3D27D4EB4FULL;
+		return (size_t) (h ^ (h >> 29)) & mask;
+	}
+	void Grow() {
+		mask = 2*mask + 1;
+		slots.assign(mask+1, -1);
+		for (long id= 0; id < Size(); ++id) {
+			size_t slot = Slot(keys[2*id], keys[2*id+1]);
+			while (slots[slot] >= 0) slot = (slot + 1) & mask;
+			slots[slot] = id;
+		}
+	}
+	std::vector<long> slots;
+	std::vector<int64_t> keys;
+	size_t mask;
+};
+
+/*
+ ContiguityBuilder::GalHash
+ Queen contiguity as "shares a vertex", rook as "shares an edge", with
+ points closer than tolerance in x and y taken as one vertex (0: exact
+ coordinates).  The points are hashed by their cell in a grid of cell
+ size tolerance; a point takes the vertex of its own cell or else of
+ the nearest point within tolerance in the eight adjacent cells, so two
+ points either side of a cell boundary still match.  Every point is hashed once, so
+ the cost is linear in
+ the number of vertices; the polygons are visited in Morton order of
+ their boxes, so most lookups find a vertex inserted shortly before.
+ Rook pairs are the queen pairs that also share the next or previous
+ vertex of a ring.  Unlike the sweep it does not see neighbors that
+ touch where one of them has no vertex, e.g. an edge that ends in the
+ middle of a neighbor's edge; use Gal for such layers.
+ */
+GalElement* ContiguityBuilder::GalHash(int criteria, double tolerance,
+									   WeightsArena* arena)
+{
+	if (!polygons) {
+		if (error.empty()) error = "no shapefile open";
+		return NULL;
+	}
+	if (tolerance < 0) {
+		error = "negative snapping tolerance";
+		return NULL;
+	}
+	const double limit = 4.0e18; // snapped coordinates must fit 64 bits
+	long rec, cnt, i, j;
+
+	// visiting order: Morton code of the box centers
+	std::vector<std::pair<uint64_t, long> > order(records);
+	const double x0 = big_box->_min().x, y0 = big_box->_min().y;
+	double wx = big_box->_max().x - x0, wy = big_box->_max().y - y0;
+	wx = wx > 0 ? 65535 / wx : 0;
+	wy = wy > 0 ? 65535 / wy : 0;
+	for (rec= 0; rec < records; ++rec) {
+		const Box& bx = boxes[rec];
+		uint64_t cx = (uint64_t) ((0.5*(bx._min().x+bx._max().x) - x0) * wx);
+		uint64_t cy = (uint64_t) ((0.5*(bx._min().y+bx._max().y) - y0) * wy);
+		uint64_t code = 0;
+		for (int bit= 15; bit >= 0; --bit)
+			code = (code << 2) | (((cx >> bit) & 1) << 1) | ((cy >> bit) & 1);
+		order[rec] = std::make_pair(code, rec);
+	}
+	std::sort(order.begin(), order.end());
+
+	// vid[first[rec] + cnt]: vertex id of point cnt of rec; closing[pt]
+	// marks the last point of a part
+	std::vector<long> first(records+1, 0);
+	for (rec= 0; rec < records; ++rec)
+		first[rec+1] = first[rec] + polygons->NumPoints(rec);
+	const long total = first[records];
+	std::vector<long> vid(total);
+	std::vector<char> closing(total, 0);
+	KeyTable vertices(total/2); // most vertices are shared
+	// with a tolerance the table numbers grid cells: cell_vertex[c] is
+	// the vertex of cell c, at[v] the point that made vertex v
+	std::vector<long> cell_vertex;
+	std::vector<BasePoint> at;
+	for (long o= 0; o < records; ++o) {
+		rec = order[o].second;
+		const BasePoint* p = polygons->Points(rec);
+		const long n = polygons->NumPoints(rec);
+		long* v = n ? &vid[first[rec]] : NULL;
+		for (cnt= 0; cnt < n; ++cnt) {
+			int64_t kx, ky;
+			if (tolerance > 0) {
+				double sx = floor(p[cnt].x / tolerance + 0.5);
+				double sy = floor(p[cnt].y / tolerance + 0.5);
+				if (fabs(sx) > limit || fabs(sy) > limit) {
+					error = "snapping tolerance too small for the coordinates";
+					return NULL;
+				}
+				kx = (int64_t) sx;
+				ky = (int64_t) sy;
+				long best = -1;
+				double best_d = tolerance;
+				const long own = vertices.Find(kx, ky);
+				if (own >= 0) best = cell_vertex[own];
+				else for (int dx= -1; dx <= 1; ++dx) {
+					for (int dy= -1; dy <= 1; ++dy) {
+						long c = vertices.Find(kx+dx, ky+dy);
+						if (c < 0) continue;
+						const BasePoint& q = at[cell_vertex[c]];
+						double d = std::max(fabs(q.x - p[cnt].x),
+											fabs(q.y - p[cnt].y));
+						if (d <= best_d) {
+							best_d = d;
+							best = cell_vertex[c];
+						}
 					}
 				}
+				if (best < 0) {
+					// a new vertex, in a cell of its own
+					best = (long) at.size();
+					at.push_back(p[cnt]);
+					vertices.Id(kx, ky);
+					cell_vertex.push_back(best);
+				}
+				v[cnt] = best;
+			} else {
+				double x = p[cnt].x + 0.0, y = p[cnt].y + 0.0; // -0 is 0
+				memcpy(&kx, &x, sizeof(double));
+				memcpy(&ky, &y, sizeof(double));
+				v[cnt] = vertices.Id(kx, ky);
 			}
 		}
-		
-		LastIx = k;
-		if (!Lag) {
-			HO[irow].alloc(nLag[p-2]);
-			k = nLag[p-2];
+		const long parts = polygons->NumParts(rec);
+		const long* part = polygons->Parts(rec);
+		for (i= 0; i < parts; ++i) {
+			long end = i+1 < parts ? part[i+1] : n;
+			if (end > 0 && end <= n) closing[first[rec] + end-1] = 1;
 		}
-		else HO[irow].alloc(LastIx);
-		
-		for (j=0;j<LastIx;j++) {
-			if (Lag) {
-				HO[irow].Push(Queue[j]);
-			} else {
-				
-				if (OC[Queue[j]] == p) {
-					HO[irow].Push(Queue[j]);
+	}
+
+	// points of each vertex, grouped by a counting sort on the vertex id
+	const long nv = tolerance > 0 ? (long) at.size() : vertices.Size();
+	std::vector<long> vfirst(nv+1, 0), vpts(total), rec_of(total);
+	for (i= 0; i < total; ++i) ++vfirst[vid[i]+1];
+	for (i= 0; i < nv; ++i) vfirst[i+1] += vfirst[i];
+	{
+		std::vector<long> pos(vfirst.begin(), vfirst.end()-1);
+		for (long o= 0; o < records; ++o) {
+			rec = order[o].second;
+			for (i= first[rec]; i < first[rec+1]; ++i) {
+				vpts[pos[vid[i]]++] = i;
+				rec_of[i] = rec;
+			}
+		}
+	}
+
+	// the rows, in visiting order; seen[r] == rec once r is in row rec
+	std::vector<long> nbrs, row_at(records), row_size(records), row;
+	std::vector<long> seen(records, -1);
+	for (long o= 0; o < records; ++o) {
+		rec = order[o].second;
+		row.clear();
+		for (i= first[rec]; i < first[rec+1]; ++i) {
+			const long a = vid[i];
+			if (vfirst[a+1] - vfirst[a] < 2) continue;
+			// the next point of the ring, for rook
+			const long b = !closing[i] && i+1 < first[rec+1] ? vid[i+1] : -1;
+			if (criteria == 1 && (b < 0 || b == a)) continue;
+			for (j= vfirst[a]; j < vfirst[a+1]; ++j) {
+				const long q = vpts[j], r = rec_of[q];
+				if (r == rec || seen[r] == rec) continue;
+				if (criteria == 1) {
+					bool next = !closing[q] && q+1 < first[r+1] && vid[q+1] == b;
+					bool prev = q > first[r] && !closing[q-1] && vid[q-1] == b;
+					if (!next && !prev) continue;
+				}
+				seen[r] = rec;
+				row.push_back(r);
+			}
+		}
+		std::sort(row.begin(), row.end());
+		row_at[rec] = (long) nbrs.size();
+		nbrs.insert(nbrs.end(), row.begin(), row.end());
+		row_size[rec] = (long) row.size();
+	}
+
+	GalElement* full = new GalElement[records];
+	for (rec= 0; rec < records; ++rec) {
+		const long sz = row_size[rec];
+		if (sz && full[rec].alloc(sz, arena)) {
+			for (cnt= 0; cnt < sz; ++cnt) full[rec].Push(nbrs[row_at[rec]+cnt]);
+		}
+	}
+	return full;
+}
+
+/*
+ shp2gal
+ Rook (criteria 1) or queen (criteria 0) contiguity of fname, from the
+ polygon sweep or, with engine ContiguityBuilder::hash, from shared
+ vertices and edges snapped to tolerance (see GalHash).
+ */
+GalElement* shp2gal(const char* fname, int criteria, bool save,
+					WeightsArena* arena, int engine, double tolerance)
+{
+	ContiguityBuilder builder;
+	if (!builder.Open(fname)) return NULL;
+	if (engine == ContiguityBuilder::hash)
+		return builder.GalHash(criteria, tolerance, arena);
+	return builder.Gal(criteria, arena);
+}
+
+/*
+ shp2bl
+ Contiguity weighted by the length of the shared boundary, from the same
+ sweep that finds the neighbors.  With perimeter_share the weight of j
+ for i is that length over the perimeter of i.
+ */
+GwtElement* shp2bl(const char* fname, int criteria, bool perimeter_share,
+				   WeightsArena* arena)
+{
+	ContiguityBuilder builder;
+	if (!builder.Open(fname)) return NULL;
+	return builder.BoundaryLength(criteria, perimeter_share, arena);
+}
+
+/*
+ HOContiguityWorker
+ Breadth-first search to order p from every row in [from, to).  Visited
+ observations are stamped with the id of the current row, so the stamp
+ array never has to be reset between rows.  Neighbors found for the rows
+ are appended to nbrs, row by row, in ascending order.
+ */
+class HOContiguityWorker : public GenThread {
+public:
+	HOContiguityWorker(const int order, const long num_obs,
+					   const GalElement* w, const bool cml,
+					   const long first, const long last)
+	: counts(last-first, 0), p(order), obs(num_obs), W(w), cumulative(cml),
+	from(first), to(last), stamp(num_obs, -1) {}
+	std::vector<long> counts; // neighbors of rows from .. to-1
+	std::vector<long> nbrs;
+protected:
+	void run();
+private:
+	int p;
+	long obs;
+	const GalElement* W;
+	bool cumulative;
+	long from, to;
+	std::vector<long> stamp; // row that last visited each observation
+	std::vector<long> queue;
+};
+
+void HOContiguityWorker::run()
+{
+	for (long irow= from; irow < to; ++irow) {
+		queue.clear();
+		stamp[irow] = irow;
+		const long* dt = W[irow].dt();
+		for (long j= 0, sz= W[irow].Size(); j < sz; ++j) {
+			if (stamp[dt[j]] != irow) {
+				stamp[dt[j]] = irow;
+				queue.push_back(dt[j]);
+			}
+		}
+		// [curr, last) is the frontier: the neighbors of order c-1
+		size_t curr= 0, last= queue.size();
+		for (int c= 2; c <= p && curr < last; ++c) {
+			for (; curr < last; ++curr) {
+				dt = W[queue[curr]].dt();
+				for (long j= 0, sz= W[queue[curr]].Size(); j < sz; ++j) {
+					if (stamp[dt[j]] != irow) {
+						stamp[dt[j]] = irow;
+						queue.push_back(dt[j]);
+					}
 				}
-				
 			}
-			OC[Queue[j]] = 0;
+			last = queue.size();
 		}
-		OC[irow] = 0;
+		// cumulative keeps every order 1..p, otherwise only order p,
+		// which is left in [curr, last) (empty if the search ran out)
+		size_t begin = cumulative ? 0 : curr;
+		std::sort(queue.begin() + begin, queue.begin() + last);
+		nbrs.insert(nbrs.end(), queue.begin() + begin, queue.begin() + last);
+		counts[irow-from] = (long) (last - begin);
 	}
-	return HO;
+}
+
+/*
+ HOContiguity
+ Contiguity of order p computed from the first order matrix W, written
+ directly in CSR form.  With cumulative== true all the neighbors of
+ orders 1..p are included, otherwise only those of order p ("lag only").
+ Rows are split over nthreads threads (all processors when nthreads <= 0).
+ */
+bool HOContiguity(const int p, long obs, const GalElement *W,
+				  bool cumulative, GalCsr& HO, int nthreads)
+{
+	if (W == NULL || obs < 1 || p <= 1 || p > obs-1) return false;
+	
+	int nt = GenThreads::NumThreads(obs, nthreads);
+	std::vector<HOContiguityWorker*> workers(nt);
+	std::vector<GenThread*> threads(nt);
+	int t;
+	for (t= 0; t < nt; ++t) {
+		workers[t] = new HOContiguityWorker(p, obs, W, cumulative,
+											GenThreads::BlockBegin(obs, t, nt),
+											GenThreads::BlockBegin(obs, t+1, nt));
+		threads[t] = workers[t];
+	}
+	GenThreads::RunAll(threads);
+	
+	HO.offsets.resize(obs+1);
+	HO.offsets[0] = 0;
+	long irow = 0;
+	for (t= 0; t < nt; ++t) {
+		const std::vector<long>& counts = workers[t]->counts;
+		for (size_t i= 0; i < counts.size(); ++i, ++irow)
+			HO.offsets[irow+1] = HO.offsets[irow] + counts[i];
+	}
+	HO.nbrs.resize(HO.offsets[obs]);
+	long pos = 0;
+	for (t= 0; t < nt; ++t) {
+		std::copy(workers[t]->nbrs.begin(), workers[t]->nbrs.end(),
+				  HO.nbrs.begin() + pos);
+		pos += (long) workers[t]->nbrs.size();
+		delete workers[t];
+	}
+	return true;
+}
+
+// Lag: True includes all the lower orders (cumulative); otherwise only
+// the neighbors of order p
+GalElement *HOContiguity(const int p, long obs, GalElement *W, bool Lag,
+						 WeightsArena* arena)
+{
+	GalCsr HO;
+	if (!HOContiguity(p, obs, W, Lag, HO)) return NULL;
+	return HO.ToGal(arena);
 }
 
 void DevFromMean(int nObs, DataPoint* RawData)
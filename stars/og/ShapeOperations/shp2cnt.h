@@ -21,22 +21,113 @@
 #define __GEODA_CENTER_SHP_2_CNT_H__
 
 #include "GalWeight.h"
+#include "GwtWeight.h"
+#include <string>
 #include <vector>
 
+class Box;
+class BasePartition;
+class PartitionM;
+class PolygonArena;
+class PackedRTree;
+
+/*
+ ContiguityBuilder
+ Rook (criteria 1) or queen (criteria 0) contiguity of a polygon
+ shapefile.  All the working state (record offsets, bounding boxes, the
+ polygon vertices and the plane sweep partitions) belongs to the
+ builder, so separate builders can run at the same time on different
+ threads.  Open reads the layer once, vertices included; Gal and
+ BoundaryLength can then be called any number of times, e.g. for rook
+ and queen.  Failures return false or NULL, with the reason in Error().
+ */
+class ContiguityBuilder {
+public:
+	enum Engine { sweep= 0, hash= 1 };
+	enum Index { automatic_index= 0, partition_index= 1, rtree_index= 2 };
+	ContiguityBuilder();
+	virtual ~ContiguityBuilder();
+
+	/** index: where the sweep takes its candidate pairs from (see Open) */
+	bool Open(const char* shp_fname, int index= automatic_index);
+	void Close();
+	long NumObs() const { return records; }
+	const std::string& Error() const { return error; }
+
+	/** full, sorted contiguity matrix of NumObs() rows.  The polygon
+	 sweeps run on nthreads threads (all processors when nthreads <= 0);
+	 the result is the same for any number of threads. */
+	GalElement* Gal(int criteria, WeightsArena* arena= 0, int nthreads= 0);
+	/** contiguity weighted by the shared boundary length (see shp2bl) */
+	GwtElement* BoundaryLength(int criteria, bool perimeter_share= false,
+							   WeightsArena* arena= 0, int nthreads= 0);
+	/** contiguity from shared vertices (queen) or edges (rook) snapped
+	 to tolerance, much faster than Gal on clean polygon layers */
+	GalElement* GalHash(int criteria, double tolerance= 0,
+						WeightsArena* arena= 0);
+
+private:
+	bool ReadOffsets();
+	bool ReadBoxes();
+	bool ReadPolygons();
+	bool Fail(const char* msg);
+	GalElement* Half(const int crit, WeightsArena* arena,
+					 GwtElement* bl= NULL, double* perimeter= NULL,
+					 int nthreads= 0);
+	GalElement* MakeFull(GalElement* half, WeightsArena* arena) const;
+	ContiguityBuilder(const ContiguityBuilder&);
+	ContiguityBuilder& operator=(const ContiguityBuilder&);
+
+	std::string fname;
+	std::string error;
+	long records;              // dimension of the weights matrix
+	long* offsets;             // location of each record in the shp file
+	Box* boxes;                // bounding box of each polygon
+	Box* big_box;              // bounding box of the entire map
+	BasePartition* min_x;      // lower(x) of each polygon
+	BasePartition* max_x;      // upper(x) of each polygon
+	PartitionM* y;             // y extent of each polygon
+	PackedRTree* rtree;        // boxes, when not using the partitions
+	PolygonArena* polygons;    // vertices of all polygons
+};
+
 bool IsLineShapeFile(const char* fname);
 #define geoda_sqr(x) ( (x) * (x) )
-GalElement* HOContiguity(const int p, long obs, GalElement *W, bool Lag);
+GalElement* HOContiguity(const int p, long obs, GalElement *W, bool Lag,
+						 WeightsArena* arena= 0);
+bool HOContiguity(const int p, long obs, const GalElement *W,
+				  bool cumulative, GalCsr& HO, int nthreads= 0);
 /*
 GalElement* shp2gal(const wxString& fname, int criteria, bool save= true);
 bool SaveGal(const GalElement *full, const wxString& ifname, 
 			 const wxString& ofname, const wxString& vname,
 			 const std::vector<wxInt64>& id_vec);
 */		 
-GalElement* shp2gal(const char* fname, int criteria, bool save= true);
+GalElement* shp2gal(const char* fname, int criteria, bool save= true,
+					WeightsArena* arena= 0,
+					int engine= ContiguityBuilder::sweep,
+					double tolerance= 0);
+GwtElement* shp2bl(const char* fname, int criteria,
+				   bool perimeter_share= false, WeightsArena* arena= 0);
+/** an empty vname writes a record order header, "0 n" */
 bool SaveGal(const GalElement *full,
 			 const char* ofname, 
 			 const char* vname,
 			 const std::vector<int>& id_vec);
+bool SaveGal(const GalCsr& full,
+			 const char* ofname,
+			 const char* vname,
+			 const std::vector<int>& id_vec);
+/** the rows in a binary .galb file of record numbers (see WeightsWriter);
+ false unless ofname ends with .galb */
+bool SaveGalBinary(const GalElement *full,
+				   const char* ofname,
+				   const char* vname,
+				   const std::vector<int>& id_vec);
+bool SaveGalBinary(const GalCsr& full,
+				   const char* ofname,
+				   const char* vname,
+				   const std::vector<int>& id_vec);
 
 
 #endif
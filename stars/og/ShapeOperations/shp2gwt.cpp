@@ -24,6 +24,7 @@
 #include "shp.h"
 #include "shp2gwt.h"
 #include "shp2cnt.h"
+#include "WeightsWriter.h"
 #include <math.h>
 #include <stdio.h>
 #include <time.h>
@@ -31,6 +32,7 @@
 #include "../GeoDaConst.h"
 #include "../GenGeomAlgs.h"
 #include "../logger.h"
+#include "../GenThreads.h"
 //#include "ShapeFileTriplet.h" by xun
 #include "ShapeFileTypes.h"
 //#include "DbfFile.h" removed by xun
@@ -251,34 +253,22 @@ double ComputeMaxDistance(const std::vector<double>& x,
 						  const std::vector<double>& y, int method) 
 {
 	int Records = x.size();
-	BasePoint minmax[2];
-	
-	BasePoint *centroid= new BasePoint [ Records ];
-	int rec = 0;
-	for (rec =0; rec < Records; rec++) centroid[rec].setXY(x.at(rec),y.at(rec));
-	
-	minmax[0].setXY(centroid[0].x, centroid[0].y);
-	minmax[1].setXY(centroid[0].x, centroid[0].y);
-	
-	for (rec = 1; rec < Records; ++rec) {
-		if (centroid[rec].x > minmax[1].x) 
-			minmax[1].setXY(centroid[rec].x, minmax[1].y);
-		else if (centroid[rec].x < minmax[0].x) 
-			minmax[0].setXY(centroid[rec].x, minmax[0].y);
-		if (centroid[rec].y > minmax[1].y) 
-			minmax[1].setXY(minmax[1].x, centroid[rec].y);
-		else if (centroid[rec].y < minmax[0].y) 
-			minmax[0].setXY(minmax[0].x, centroid[rec].y);
+	if (Records < 1 || x.size() != y.size()) return 0.0;
+	
+	// corners of the bounding box of the points
+	double min_x = x[0], max_x = x[0], min_y = y[0], max_y = y[0];
+	for (int rec = 1; rec < Records; ++rec) {
+		if (x[rec] > max_x) max_x = x[rec];
+		else if (x[rec] < min_x) min_x = x[rec];
+		if (y[rec] > max_y) max_y = y[rec];
+		else if (y[rec] < min_y) min_y = y[rec];
 	}
 	
-	double dist = sqrt(geoda_sqr(minmax[1].x - minmax[0].x)
-					   + geoda_sqr(minmax[1].y - minmax[0].y));
 	if (method == 2) {
 		// Arc Distance
-		dist = GenGeomAlgs::ComputeArcDist(minmax[0].x, minmax[0].y,
-										   minmax[1].x, minmax[1].y);
+		return GenGeomAlgs::ComputeArcDist(min_x, min_y, max_x, max_y);
 	}
-	return dist;
+	return sqrt(geoda_sqr(max_x - min_x) + geoda_sqr(max_y - min_y));
 }
 
 /* xun 
@@ -512,33 +502,71 @@ bool WriteGwt(const GwtElement *g,
 	}
 	int Obs = (int) id_vec.size();
 	
-    std::ofstream out(ofname, std::ios::out);
-    if (!(out.is_open() && out.good())) {
-        return false;
-    }
+	WeightsWriter out(ofname);
+	if (!out.IsOpen()) {
+		return false;
+	}
 	
     int degree_fl = geodaL ? 0 : degree_flag ;
 	
 	string fn(ofname);
 	string local = GenUtils::GetTheFileTitle(fn);
 	
-    out << degree_fl << " " << Obs << " " << local.c_str();
-    out << " " << vname << endl;
+	out.PutInt(degree_fl);
+	out.Put(' ');
+	out.PutInt(Obs);
+	out.Put(' ');
+	out.Put(local.c_str());
+	out.Put(' ');
+	out.Put(vname);
+	out.Put('\n');
     
     for (int i=0; i < Obs; i++) {
         for (long nbr= 0; nbr < g[i].Size(); ++nbr) {
             GwtNeighbor  current= g[i].elt(nbr);
-            double w = current.weight;
-            out << id_vec[i] << ' ' << id_vec[current.nbx];
-			out << ' ' << setprecision(9) << setw(18) << w << '\n';
+			out.PutInt(id_vec[i]);
+			out.Put(' ');
+			out.PutInt(id_vec[current.nbx]);
+			out.Put(' ');
+			out.PutWeight(current.weight);
+			out.Put('\n');
         }
     }
 	
-    return true;
+    return out.Close();
+}
+
+bool WriteGwtBinary(const GwtElement *g,
+					const char* ofname,
+					const char* vname,
+					const std::vector<int>& id_vec)
+{
+	if (g == NULL || id_vec.size() == 0 ||
+		!WeightsWriter::HasExt(ofname, WeightsWriter::GwtExt)) {
+		return false;
+	}
+	long Obs = (long) id_vec.size(), i, nbr;
+	WeightsWriter out(ofname, true);
+	if (!out.IsOpen()) return false;
+	out.WriteHeader(WeightsWriter::GwtMagic, vname, id_vec);
+	int64_t start = 0;
+	out.WriteInt64(start);
+	for (i= 0; i < Obs; i++) out.WriteInt64(start += g[i].Size());
+	for (i= 0; i < Obs; i++) {
+		for (nbr= 0; nbr < g[i].Size(); nbr++) {
+			out.WriteInt32((int32_t) g[i].elt(nbr).nbx);
+		}
+	}
+	for (i= 0; i < Obs; i++) {
+		for (nbr= 0; nbr < g[i].Size(); nbr++) {
+			out.WriteDouble(g[i].elt(nbr).weight);
+		}
+	}
+	return out.Close();
 }
 
 GwtElement * MakeFullGwt(GwtElement * half, const long dim, int degree,
-						 bool standardize)  
+						 bool standardize, WeightsArena* arena)  
 {
 	long * Count = new long [ dim ], cnt, nbr, Nz= 0;
 	for (cnt= 0; cnt < dim; ++cnt)
@@ -547,13 +575,14 @@ GwtElement * MakeFullGwt(GwtElement * half, const long dim, int degree,
 		for (nbr= 0; nbr < half[cnt].Size(); ++nbr)
 			++Count[ half[cnt].elt(nbr).nbx ];
 	GwtElement *tmp = new GwtElement [dim], * full= new GwtElement [ dim ];
+	WeightsArena* tmp_arena = arena ? new WeightsArena : 0;
 	bool good= true;
 	double min = 1e10, *sum = new double [dim];
 	
 	for (cnt= 0; cnt < dim; ++cnt)  {
 		if (Count[cnt]) {
-			good &= full[cnt].alloc( Count[cnt] );
-			good &= tmp[cnt].alloc(Count[cnt]);
+			good &= full[cnt].alloc( Count[cnt], arena );
+			good &= tmp[cnt].alloc(Count[cnt], tmp_arena);
 		}
 		Nz += Count[cnt];
 		for (nbr = 0; nbr < half[cnt].Size(); nbr++)
@@ -614,6 +643,8 @@ GwtElement * MakeFullGwt(GwtElement * half, const long dim, int degree,
 	}
 	delete [] tmp;
 	tmp = NULL;
+	if (tmp_arena) delete tmp_arena;
+	tmp_arena = NULL;
 	delete [] Count;
 	Count = NULL;
 	// cout << " nonzero elements: " << Nz << endl;
@@ -632,7 +663,8 @@ GwtElement* shp2gwt(int Obs,
 					std::vector<double>& y,
 					const double threshold, 
 					const int degree,
-					int	method) // 0: Euclidean dist, 1:Arc
+					int	method, // 0: Euclidean dist, 1:Arc
+					WeightsArena* arena)
 {
 	long Records = Obs, cnt;
 	
@@ -661,6 +693,7 @@ GwtElement* shp2gwt(int Obs,
 	
 	GwtNeighbor * buffer	= new GwtNeighbor[ Records];
 	GwtElement * GwtHalf	= new GwtElement[ Records];
+	WeightsArena* half_arena = arena ? new WeightsArena : 0;
 	long BufferSize= 0, included;
 	
 	for (part= 0; part < gx; ++part)  
@@ -686,7 +719,7 @@ GwtElement* shp2gwt(int Obs,
 				Center.CheckParticle(A, cell, BufferSize, buffer);
 				Center.CheckParticle(B, cell, BufferSize, buffer);
 			};
-			GwtHalf[curr].alloc(BufferSize);
+			GwtHalf[curr].alloc(BufferSize, half_arena);
 			while (BufferSize)
 				GwtHalf[curr].Push(buffer[--BufferSize]);
 		};
@@ -703,9 +736,11 @@ GwtElement* shp2gwt(int Obs,
 	};
 	delete  A;
 	delete  B;
-	GwtElement * GwtFull= MakeFullGwt(GwtHalf, Records, degree, false);
+	GwtElement * GwtFull= MakeFullGwt(GwtHalf, Records, degree, false, arena);
 	delete [] GwtHalf;
 	GwtHalf = NULL;
+	if (half_arena) delete half_arena;
+	half_arena = NULL;
 	delete [] buffer;
 	buffer = NULL;
 	
@@ -713,99 +748,190 @@ GwtElement* shp2gwt(int Obs,
 }
 
 #include "../kNN/ANN.h"			// ANN declarations
-GwtElement* DynKNN(const std::vector<double>& x, const std::vector<double>& y,
-				   int k, int method)
+#include "KdTree2D.h"
+
+/*
+ KNNWorker
+ The k nearest neighbors of the points at positions [from, to) of the
+ kd-tree's leaf order, so consecutive queries are close in space and
+ walk the same part of the tree.  Euclidean searches use the plane tree
+ of x and y, arcs the ANN tree of pts.  The rows were allocated by the
+ caller; each worker only pushes into the rows of its own points.  With
+ kth set it only records the distance to the k-th neighbor, in kth.
+ */
+class KNNWorker : public GenThread {
+public:
+	KNNWorker(const KdTree2D* plane, const double* x, const double* y,
+			  ANNkd_tree* tree, ANNpointArray pts, const int k,
+			  const int method, GwtElement* gwt, double* kth,
+			  const long first, const long last)
+	: plane(plane), x(x), y(y), tree(tree), pts(pts), k(k), method(method),
+	gwt(gwt), kth(kth), from(first), to(last), nn_idx(k+1), ann_idx(k+1),
+	dists(k+1) {}
+protected:
+	void run();
+private:
+	/* both trees return each distance squared; for arcs it is the chord
+	 between points on the unit sphere */
+	double Dist(int j) const {
+		double d = sqrt(dists[j]);
+		return method == 2 ? GenGeomAlgs::ChordToArcDist(d) : d; }
+	const KdTree2D* plane;
+	const double *x, *y;
+	ANNkd_tree* tree;
+	ANNpointArray pts;
+	int k, method;
+	GwtElement* gwt;
+	double* kth;
+	long from, to;
+	std::vector<long> nn_idx;
+	std::vector<ANNidx> ann_idx;
+	std::vector<double> dists;
+};
+
+void KNNWorker::run()
 {
-	int obs = x.size();
-	if (obs	< 3 || k < 1 || k > obs || x.size() != y.size()) return NULL;
-	
-	int		dim		= 2;		// dimension
-	ANNpointArray	data_pts;		// data points
-	ANNpoint			query_pt;		// query point
-	ANNidxArray		nn_idx;			// near neighbor indices
-	ANNdistArray	dists;			// near neighbor distances
-	ANNkd_tree		*the_tree;		// search structure
-	
-	GwtElement *gwt = new GwtElement[obs];
-	if (gwt == NULL)
-		return NULL;
-	
-	query_pt	= annAllocPt(dim);			// allocate query point
-	data_pts	= annAllocPts(obs, dim);	// allocate data points
-	nn_idx		= new ANNidx[k];			// allocate near neigh indices
-	dists		= new ANNdist[k];			// allocate near neighbor dists
-	int i = 0;
-	for (i=0;i<obs; i++) {
-		data_pts[i][0] = x.at(i);
-		data_pts[i][1] = y.at(i);
+	int j;
+	for (long p= from; p < to; ++p) {
+		long i;
+		if (plane) {
+			i = plane->Order()[p];
+			plane->Knn(x[i], y[i], k+1, &nn_idx[0], &dists[0]);
+		} else {
+			i = tree->pointOrder()[p];
+			tree->annkSearch(pts[i], k+1, &ann_idx[0], &dists[0]);
+			for (j= 0; j <= k; ++j) nn_idx[j] = ann_idx[j];
+		}
+		// i itself is among the k+1 unless k+1 points coincide with it
+		int skip = k;
+		for (j= 0; j <= k; ++j) if (nn_idx[j] == i) { skip = j; break; }
+		if (kth) {
+			// the k-th of the others: the last one found unless that is i
+			kth[i] = Dist(skip == k ? k-1 : k);
+			continue;
+		}
+		for (j= 0; j <= k; ++j) {
+			if (j != skip) gwt[i].Push(GwtNeighbor(nn_idx[j], Dist(j)));
+		}
 	}
-	
-	the_tree = new ANNkd_tree(data_pts,obs,dim);
-	
-	for (i=0; i<obs; i++) {
-		the_tree->annkSearch(data_pts[i], k, nn_idx, dists,0.0, method);
-		gwt[i].alloc(k-1);
-		for (int j=1; j<k; j++) {
-			GwtNeighbor e;
-			e.nbx = nn_idx[j];
-			e.weight = sqrt(dists[j]);  // annkSearch returns each distance
-			// squared, so take sqrt.
-			gwt[i].Push(e);
+}
+
+/*
+ RunKNN
+ Shares one kd-tree of the points among nthreads KNNWorkers (all
+ processors when nthreads <= 0), which fill the rows of gwt or kth.
+ Euclidean neighbors come from a KdTree2D, whose leaves are scanned two
+ points at a time, mapped from index_fname when that holds the tree of
+ these points.  Arcs are searched with ANN as chords between points
+ on the unit sphere, which keeps the kd-tree's pruning exact.
+ */
+static void RunKNN(const std::vector<double>& x, const std::vector<double>& y,
+				   int k, int method, int nthreads, GwtElement* gwt,
+				   double* kth, const char* index_fname)
+{
+	long obs = (long) x.size(), i;
+	KdTree2D plane;
+	ANNpointArray data_pts = NULL;
+	ANNkd_tree* the_tree = NULL;
+	if (method == 2) {
+		data_pts = annAllocPts(obs, 3);
+		for (i= 0; i < obs; i++) {
+			GenGeomAlgs::LonLatToUnit(x[i], y[i], data_pts[i]);
 		}
+		the_tree = new ANNkd_tree(data_pts, obs, 3);
+	} else if (index_fname && index_fname[0]) {
+		plane.Open(&x[0], &y[0], obs, index_fname);
+	} else {
+		plane.Build(&x[0], &y[0], obs);
+	}
+	
+	int nt = GenThreads::NumThreads(obs, nthreads), t;
+	std::vector<GenThread*> workers(nt);
+	for (t= 0; t < nt; t++) {
+		workers[t] = new KNNWorker(the_tree ? NULL : &plane, &x[0], &y[0],
+								   the_tree, data_pts, k, method, gwt, kth,
+								   GenThreads::BlockBegin(obs, t, nt),
+								   GenThreads::BlockBegin(obs, t+1, nt));
 	}
+	GenThreads::RunAll(workers);
+	for (t= 0; t < nt; t++) delete workers[t];
+	
+	if (the_tree) delete the_tree;
+	if (data_pts) annDeallocPts(data_pts);
+}
+
+/*
+ AllKNN
+ The k nearest neighbors of every point among the other points, nearest
+ first, weighted by their distance (method 1 Euclidean, 2 arc in miles,
+ x longitude and y latitude).  The points are queried in the kd-tree's
+ leaf order.
+ */
+GwtElement* AllKNN(const std::vector<double>& x, const std::vector<double>& y,
+				   int k, int method, int nthreads, WeightsArena* arena,
+				   const char* index_fname)
+{
+	long obs = (long) x.size(), i;
+	if (obs < 2 || k < 1 || k >= obs || x.size() != y.size()) return NULL;
+	
+	GwtElement* gwt = new GwtElement[obs];
+	for (i= 0; i < obs; i++) gwt[i].alloc(k, arena);
+	RunKNN(x, y, k, method, nthreads, gwt, NULL, index_fname);
 	return gwt;
 }
 
+bool KthNeighborDistances(const std::vector<double>& x,
+						  const std::vector<double>& y, int k, int method,
+						  std::vector<double>& dist, int nthreads,
+						  const char* index_fname)
+{
+	long obs = (long) x.size();
+	if (obs < 2 || k < 1 || k >= obs || x.size() != y.size()) return false;
+	dist.resize(obs);
+	RunKNN(x, y, k, method, nthreads, NULL, &dist[0], index_fname);
+	return true;
+}
+
+/* k nearest neighbors with i itself counted in k (see AllKNN) */
+GwtElement* DynKNN(const std::vector<double>& x, const std::vector<double>& y,
+				   int k, int method, WeightsArena* arena)
+{
+	int obs = x.size();
+	if (obs	< 3 || k < 1 || k > obs || x.size() != y.size()) return NULL;
+	if (k == 1) return new GwtElement[obs];
+	return AllKNN(x, y, k-1, method, 0, arena);
+}
+
 
+/*
+ ComputeCutOffPoint
+ The largest nearest neighbor distance: the smallest distance band
+ that leaves no point without a neighbor.
+ */
 double ComputeCutOffPoint(const std::vector<double>& x,
 						  const std::vector<double>& y,
 						  int method) // 1 == Euclidean Dist, 2== Arc Dist
 {
 	int obs = x.size();
 	if (obs < 3 || x.size() != y.size()) return 0.0;
-		
-	int	dim	= 2;		// dimension
-	ANNpointArray	data_pts;		// data points
-	ANNpoint		query_pt;		// query point
-	ANNidxArray		nn_idx;			// near neighbor indices
-	ANNdistArray	dists;			// near neighbor distances
-	ANNkd_tree		*the_tree;		// search structure
-	
-	int k = 2;
-	query_pt = annAllocPt(dim);			// allocate query point
-	data_pts = annAllocPts(obs, dim);	// allocate data points
-	nn_idx	 = new ANNidx[k];			// allocate near neigh indices
-	dists	 = new ANNdist[k];			// allocate near neighbor dists
-	
-	for (int i=0; i<obs; i++) {
-		data_pts[i][0] = x[i];
-		data_pts[i][1] = y[i];
-	}
-	
-	the_tree = new ANNkd_tree(data_pts, obs, dim);
 	
-	the_tree->annkSearch(data_pts[0], k, nn_idx, dists, 0.0, method);
-	double minDist = sqrt(dists[1]);
-	
-	int p1 = 0, p2 = 1;
+	GwtElement* nn = AllKNN(x, y, 1, method);
+	if (!nn) return 0.0;
+	double minDist = nn[0].elt(0).weight;
+	int p1 = 0, p2 = nn[0].elt(0).nbx;
 	for (int i=1; i<obs; i++) {
-		the_tree->annkSearch(data_pts[i], k, nn_idx, dists, 0.0, method);
-		if (minDist <  sqrt(dists[1])) {
-			minDist = sqrt(dists[1]);
+		if (minDist < nn[i].elt(0).weight) {
+			minDist = nn[i].elt(0).weight;
 			p1 = i;
-			p2 = nn_idx[1];
+			p2 = nn[i].elt(0).nbx;
 		}
 	}
+	delete [] nn;
 	if (method==1) {
-		minDist = GenGeomAlgs::ComputeEucDist(data_pts[p1][0], data_pts[p1][1],
-											  data_pts[p2][0], data_pts[p2][1]);
+		minDist = GenGeomAlgs::ComputeEucDist(x[p1], y[p1], x[p2], y[p2]);
 	} else {
-		minDist = GenGeomAlgs::ComputeArcDist(data_pts[p1][0], data_pts[p1][1],
-											  data_pts[p2][0],data_pts[p2][1]);
+		minDist = GenGeomAlgs::ComputeArcDist(x[p1], y[p1], x[p2], y[p2]);
 	}
-	
-	delete the_tree;
-	
 	return minDist;
 }
 
@@ -37,17 +37,40 @@ double ComputeCutOffPoint(const std::vector<double>& x,
 double ComputeMaxDistance(const std::vector<double>& x,
 						  const std::vector<double>& y, int method);
 
+/** k nearest other points of every point, weighted by distance;
+ nthreads <= 0 uses all processors.  index_fname: a KdTree2D index file
+ for the Euclidean kd-tree, reused when it was saved for these points */
+GwtElement* AllKNN(const std::vector<double>& x, const std::vector<double>& y,
+				   int k, int method, int nthreads= 0,
+				   WeightsArena* arena= 0, const char* index_fname= 0);
+/** dist[i]: distance of point i to its k-th nearest other point, found
+ as in AllKNN; false for k outside 1 .. obs-1 */
+bool KthNeighborDistances(const std::vector<double>& x,
+						  const std::vector<double>& y, int k, int method,
+						  std::vector<double>& dist, int nthreads= 0,
+						  const char* index_fname= 0);
+/** as AllKNN with k-1 neighbors: k counts the point itself */
 GwtElement* DynKNN(const std::vector<double>& x, const std::vector<double>& y,
-				   int k, int method);
+				   int k, int method, WeightsArena* arena= 0);
 
 GwtElement* shp2gwt(int Obs, std::vector<double>& x, std::vector<double>& y,
 					const double threshold, const int degree,
-					int method);
+					int method, WeightsArena* arena= 0);
+
+/** symmetric matrix from the half matrix half, with weights raised to
+ degree (scaled by the smallest weight for degree < 0) */
+GwtElement* MakeFullGwt(GwtElement* half, const long dim, int degree,
+						bool standardize, WeightsArena* arena= 0);
 
 bool WriteGwt(const GwtElement *g,
 			  const char* ofname, 
 			  const char* vname, const std::vector<int>& id_vec,
 			  const int degree, bool gl);
+/** the rows of g in a binary .gwtb file (see WeightsWriter); false
+ unless ofname ends with .gwtb */
+bool WriteGwtBinary(const GwtElement *g,
+					const char* ofname,
+					const char* vname, const std::vector<int>& id_vec);
 
 
 
@@ -177,7 +177,8 @@ void annError(char *msg, ANNerr level)
 //----------------------------------------------------------------------
 
 int		ANNmaxPtsVisited = 0;	// maximum number of pts visited
-int		ANNptsVisited;		// number of pts visited in search
+					// (the count of each search is in
+					// its ANNkdSearchCtx)
 
 //----------------------------------------------------------------------
 //  Global function declarations
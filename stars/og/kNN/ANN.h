@@ -438,10 +438,14 @@ public:
 	int		n,		// number of points
 	int		dd,		// dimension
 	int		bs = 1,		// bucket size
-	ANNsplitRule	split = ANN_KD_SUGGEST);	// splitting method
+	ANNsplitRule	split = ANN_KD_SUGGEST,	// splitting method
+	int		nthreads = 0);	// build threads (0: all processors)
 
 	~ANNkd_tree();			// tree destructor
 
+	const ANNidx* pointOrder() const	// point indices, leaf by leaf
+		{ return pidx; }
+
 	virtual void annkSearch(		// approx k near neighbor search
 	ANNpoint	q,		// query point
 	int		k,		// number of near neighbors to return
@@ -457,6 +461,15 @@ public:
 	ANNdistArray	dd,		// dist to near neighbors (returned)
 	double		eps=0.0);	// error bound
 
+	virtual int annkFRSearch(		// approx fixed-radius kNN search
+	ANNpoint	q,		// query point
+	ANNdist		sqRad,		// squared radius
+	int		k = 0,		// number of near neighbors to return
+	ANNidxArray	nn_idx = NULL,	// nearest neighbor array (returned)
+	ANNdistArray	dd = NULL,	// dist to near neighbors (returned)
+	double		eps=0.0);	// error bound; returns the number of
+					// points within the radius (Euclidean)
+
 };
 
 //----------------------------------------------------------------------
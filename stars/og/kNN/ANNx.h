@@ -52,7 +52,6 @@ enum ANNerr {ANNwarn = 0, ANNabort = 1};
 //----------------------------------------------------------------------
 
 extern int		ANNmaxPtsVisited;// maximum number of pts visited
-extern int		ANNptsVisited;	// number of pts visited in search
 
 //----------------------------------------------------------------------
 //  Global function declarations
@@ -107,7 +106,7 @@ public:
     {  lo = annCopyPt(dd, l);  hi = annCopyPt(dd, h);  }
 
     ~ANNorthRect()			// destructor
-    {    }
+    {  annDeallocPt(lo);  annDeallocPt(hi);  }
 
     ANNbool inside(int dim, ANNpoint p);// is point p inside rectangle?
 };
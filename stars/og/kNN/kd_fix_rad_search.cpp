@@ -0,0 +1,184 @@
+//----------------------------------------------------------------------
+//	File:		kd_fix_rad_search.cpp
+//	Programmer:	Sunil Arya and David Mount
+//	Description:	Standard kd-tree fixed-radius kNN search
+//----------------------------------------------------------------------
+// Copyright (c) 1997-1998 University of Maryland and Sunil Arya and David
+// Mount.  All Rights Reserved.
+// 
+// This software and related documentation is part of the 
+// Approximate Nearest Neighbor Library (ANN).
+// 
+// Permission to use, copy, and distribute this software and its 
+// documentation is hereby granted free of charge, provided that 
+// (1) it is not a component of a commercial product, and 
+// (2) this notice appears in all copies of the software and
+//     related documentation. 
+// 
+// The University of Maryland (U.M.) and the authors make no representations
+// about the suitability or fitness of this software for any purpose.  It is
+// provided "as is" without express or implied warranty.
+//----------------------------------------------------------------------
+
+#include "ANN.h"
+#include "ANNx.h"			// all ANN includes
+#include "ANNperf.h"
+
+#include "kd_fix_rad_search.h"		// kd fixed-radius search decls
+
+//----------------------------------------------------------------------
+//	Approximate fixed-radius k nearest neighbor search
+//		The squared radius is provided, and this searches for the k
+//		nearest neighbors within this radius.  It returns the total
+//		number of points within the radius, which may be more than k,
+//		so a second call with that k returns all of them.
+//
+//		The method used for searching the kd-tree is a variation of
+//		the nearest neighbor search used in kd_search.cpp, except
+//		that the radius of the search ball is known.  We refer the
+//		reader to that file for the explanation of the recursive
+//		search procedure.  Distances are Euclidean only: the box
+//		distances used to prune the tree are.
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+//		The values common to all the recursive calls (dimension, query
+//		point, radius, error bound, points, the set of k closest points
+//		and the counts) are passed down in an ANNkdSearchCtx, which
+//		lives on the stack of annkFRSearch(), so concurrent searches do
+//		not share any state.
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+//	annkFRSearch - fixed radius search for k nearest neighbors
+//----------------------------------------------------------------------
+
+int ANNkd_tree::annkFRSearch(
+	ANNpoint			q,				// the query point
+	ANNdist				sqRad,			// squared radius search bound
+	int					k,				// number of near neighbors to return
+	ANNidxArray			nn_idx,			// nearest neighbor indices (returned)
+	ANNdistArray		dd,				// the approximate nearest neighbor
+	double				eps)			// the error bound
+{
+	ANNkdSearchCtx ctx;				// state of this search
+	ctx.dim = dim;
+	ctx.q = q;
+	ctx.sqRad = sqRad;
+	ctx.pts = pts;
+	ctx.method = 1;
+	ctx.boxPQ = NULL;
+	ctx.ptsVisited = 0;				// initialize count of points visited
+	ctx.ptsInRange = 0;				// ...and points in the range
+
+	ctx.maxErr = ANN_POW(1.0 + eps);
+	FLOP(2)							// increment floating op count
+
+	ANNmin_k pointMK(k);			// set for closest k points
+	ctx.pointMK = &pointMK;
+	// search starting at the root
+	root->ann_FR_search(annBoxDistance(q, bnd_box_lo, bnd_box_hi, dim), ctx);
+
+	for (int i = 0; i < k; i++) {		// extract the k-th closest points
+		if (dd != NULL)
+			dd[i] = pointMK.ith_smallest_key(i);
+		if (nn_idx != NULL)
+			nn_idx[i] = pointMK.ith_smallest_info(i);
+	}
+
+	return ctx.ptsInRange;				// return final point count
+}
+
+//----------------------------------------------------------------------
+//	kd_split::ann_FR_search - search a splitting node
+//		Note: This routine is similar in structure to the standard kNN
+//		search.  It visits the subtree that is closer to the query point
+//		first.  For fixed-radius search, there is no benefit in visiting
+//		one subtree before the other, but we maintain the same basic
+//		code structure for the sake of uniformity.
+//----------------------------------------------------------------------
+
+void ANNkd_split::ann_FR_search(ANNdist box_dist, ANNkdSearchCtx& ctx)
+{
+	// check dist calc term condition
+	if (ANNmaxPtsVisited != 0 && ctx.ptsVisited > ANNmaxPtsVisited) return;
+
+	// distance to cutting plane
+	ANNcoord cut_diff = ctx.q[cut_dim] - cut_val;
+
+	if (cut_diff < 0) {					// left of cutting plane
+		child[LO]->ann_FR_search(box_dist, ctx);// visit closer child first
+
+		ANNcoord box_diff = cd_bnds[LO] - ctx.q[cut_dim];
+		if (box_diff < 0)				// within bounds - ignore
+			box_diff = 0;
+										// distance to further box
+		box_dist = (ANNdist) ANN_SUM(box_dist,
+				ANN_DIFF(ANN_POW(box_diff), ANN_POW(cut_diff)));
+
+										// visit further child if in range
+		if (box_dist * ctx.maxErr <= ctx.sqRad)
+			child[HI]->ann_FR_search(box_dist, ctx);
+
+	}
+	else {								// right of cutting plane
+		child[HI]->ann_FR_search(box_dist, ctx);// visit closer child first
+
+		ANNcoord box_diff = ctx.q[cut_dim] - cd_bnds[HI];
+		if (box_diff < 0)				// within bounds - ignore
+			box_diff = 0;
+										// distance to further box
+		box_dist = (ANNdist) ANN_SUM(box_dist,
+				ANN_DIFF(ANN_POW(box_diff), ANN_POW(cut_diff)));
+
+										// visit further child if close enough
+		if (box_dist * ctx.maxErr <= ctx.sqRad)
+			child[LO]->ann_FR_search(box_dist, ctx);
+
+	}
+	FLOP(13)							// increment floating ops
+	SPL(1)								// one more splitting node visited
+}
+
+//----------------------------------------------------------------------
+//	kd_leaf::ann_FR_search - search points in a leaf node
+//		Note: The unreadability of this code is the result of
+//		some fine tuning to replace indexing by pointer operations.
+//----------------------------------------------------------------------
+
+void ANNkd_leaf::ann_FR_search(ANNdist box_dist, ANNkdSearchCtx& ctx)
+{
+	register ANNdist dist;				// distance to data point
+	register ANNcoord* pp;				// data coordinate pointer
+	register ANNcoord* qq;				// query coordinate pointer
+	register ANNcoord t;
+	register int d;
+
+	for (int i = 0; i < n_pts; i++) {	// check points in bucket
+
+		pp = ctx.pts[bkt[i]];			// first coord of next data point
+		qq = ctx.q;						// first coord of query point
+		dist = 0;
+
+		for(d = 0; d < ctx.dim; d++) {
+			COORD(1)					// one more coordinate hit
+			FLOP(5)						// increment floating ops
+
+			t = *(qq++) - *(pp++);		// compute length and adv coordinate
+										// exceeds dist to k-th smallest?
+			if( (dist = ANN_SUM(dist, ANN_POW(t))) > ctx.sqRad) {
+				break;
+			}
+		}
+
+		if (d >= ctx.dim &&						// among the k best?
+		   (ANN_ALLOW_SELF_MATCH || dist!=0)) { // and no self-match problem
+												// add it to the list
+			ctx.pointMK->insert(dist, bkt[i]);
+			ctx.ptsInRange++;					// increment point count
+		}
+	}
+	LEAF(1)								// one more leaf node visited
+	PTS(n_pts)							// increment points visited
+	ctx.ptsVisited += n_pts;			// increment number of points visited
+}
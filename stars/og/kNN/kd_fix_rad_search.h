@@ -0,0 +1,36 @@
+//----------------------------------------------------------------------
+//	File:		kd_fix_rad_search.h
+//	Programmer:	Sunil Arya and David Mount
+//	Description:	Standard kd-tree fixed-radius kNN search
+//----------------------------------------------------------------------
+// Copyright (c) 1997-1998 University of Maryland and Sunil Arya and David
+// Mount.  All Rights Reserved.
+// 
+// This software and related documentation is part of the 
+// Approximate Nearest Neighbor Library (ANN).
+// 
+// Permission to use, copy, and distribute this software and its 
+// documentation is hereby granted free of charge, provided that 
+// (1) it is not a component of a commercial product, and 
+// (2) this notice appears in all copies of the software and
+//     related documentation. 
+// 
+// The University of Maryland (U.M.) and the authors make no representations
+// about the suitability or fitness of this software for any purpose.  It is
+// provided "as is" without express or implied warranty.
+//----------------------------------------------------------------------
+
+#ifndef ANN_kd_fix_rad_search_H
+#define ANN_kd_fix_rad_search_H
+
+#include "kd_tree.h"			// kd-tree declarations
+#include "kd_util.h"			// kd-tree utilities
+#include "pr_queue_k.h"			// k-element priority queue
+#include "ANNperf.h"		// performance evaluation
+
+//----------------------------------------------------------------------
+//	The state of a search is passed down in an ANNkdSearchCtx (see
+//	kd_tree.h) rather than kept in globals.
+//----------------------------------------------------------------------
+
+#endif
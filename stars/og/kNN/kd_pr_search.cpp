@@ -69,19 +69,13 @@
 //----------------------------------------------------------------------
 
 //----------------------------------------------------------------------
-//	To keep argument lists short, a number of global variables
-//	are maintained which are common to all the recursive calls.
-//	These are given below.
+//	The values common to all the recursive calls (dimension, query
+//	point, error bound, points, box queue and the set of k closest
+//	points) are passed down in an ANNkdSearchCtx, which lives on the
+//	stack of annkPriSearch(), so concurrent searches do not share any
+//	state.
 //----------------------------------------------------------------------
 
-double		ANNprEps;		// the error bound
-int		ANNprDim;		// dimension of space
-ANNpoint	ANNprQ;			// query point
-double		ANNprMaxErr;		// max tolerable squared error
-ANNpointArray	ANNprPts;		// the points
-ANNpr_queue	*ANNprBoxPQ;		// priority queue for boxes
-ANNmin_k	*ANNprPointMK;		// set of k closest points
-
 //----------------------------------------------------------------------
 //  annkPriSearch - priority search for k nearest neighbors
 //----------------------------------------------------------------------
@@ -93,60 +87,61 @@ void ANNkd_tree::annkPriSearch(
     ANNdistArray	dd,		// dist to near neighbors (returned)
     double		eps)		// error bound (ignored)
 {
+    ANNkdSearchCtx ctx;			// state of this search
 					// max tolerable squared error
-    ANNprMaxErr = ANN_POW(1.0 + eps);
+    ctx.maxErr = ANN_POW(1.0 + eps);
     FLOP(2)				// increment floating ops
 
-    ANNprDim = dim;			// copy arguments to static equivs
-    ANNprQ = q;
-    ANNprPts = pts;
-    ANNptsVisited = 0;			// initialize count of points visited
+    ctx.dim = dim;
+    ctx.q = q;
+    ctx.pts = pts;
+    ctx.method = 1;
+    ctx.sqRad = 0;
+    ctx.ptsVisited = 0;			// initialize count of points visited
+    ctx.ptsInRange = 0;
 
-    ANNprPointMK = new ANNmin_k(k);	// create set for closest k points
+    ANNmin_k pointMK(k);		// set for closest k points
+    ctx.pointMK = &pointMK;
 
 					// distance to root box
     ANNdist box_dist = annBoxDistance(q,
 		bnd_box_lo, bnd_box_hi, dim);
 
-    ANNprBoxPQ = new ANNpr_queue(n_pts);// create priority queue for boxes
-    ANNprBoxPQ->insert(box_dist, root);	// insert root in priority queue
+    ANNpr_queue boxPQ(n_pts);		// priority queue for boxes
+    ctx.boxPQ = &boxPQ;
+    boxPQ.insert(box_dist, root);	// insert root in priority queue
 
-    while (ANNprBoxPQ->non_empty() &&
-    	(!ANNmaxPtsVisited || ANNptsVisited < ANNmaxPtsVisited)) 
+    while (boxPQ.non_empty() &&
+    	(!ANNmaxPtsVisited || ctx.ptsVisited < ANNmaxPtsVisited)) 
 		{
 			ANNkd_ptr np;			// next box from prior queue
 			// extract closest box from queue
-			ANNprBoxPQ->extr_min(box_dist, (void *&) np);
+			boxPQ.extr_min(box_dist, (void *&) np);
 			FLOP(2)				// increment floating ops
-			if (box_dist*ANNprMaxErr >= ANNprPointMK->max_key())
+			if (box_dist*ctx.maxErr >= pointMK.max_key())
 				break;
-			np->ann_pri_search(box_dist);	// search this subtree.
+			np->ann_pri_search(box_dist, ctx);	// search this subtree.
     }
 
 		for (int i = 0; i < k; i++) 
 		{	// extract the k-th closest points
-			dd[i] = ANNprPointMK->ith_smallest_key(i);
-			nn_idx[i] = ANNprPointMK->ith_smallest_info(i);
+			dd[i] = pointMK.ith_smallest_key(i);
+			nn_idx[i] = pointMK.ith_smallest_info(i);
 		}
-
-	delete ANNprPointMK;		// deallocate closest point set
-	ANNprPointMK = NULL;
-	delete ANNprBoxPQ;			// deallocate priority queue
-	ANNprBoxPQ = NULL;
 }
 
 //----------------------------------------------------------------------
 //  kd_split::ann_pri_search - search a splitting node
 //----------------------------------------------------------------------
 
-void ANNkd_split::ann_pri_search(ANNdist box_dist)
+void ANNkd_split::ann_pri_search(ANNdist box_dist, ANNkdSearchCtx& ctx)
 {
     ANNdist new_dist;			// distance to child visited later
 					// distance to cutting plane
-    ANNcoord cut_diff = ANNprQ[cut_dim] - cut_val;
+    ANNcoord cut_diff = ctx.q[cut_dim] - cut_val;
 
     if (cut_diff < 0) {			// left of cutting plane
-	ANNcoord box_diff = cd_bnds[LO] - ANNprQ[cut_dim];
+	ANNcoord box_diff = cd_bnds[LO] - ctx.q[cut_dim];
 	if (box_diff < 0)		// within bounds - ignore
 	    box_diff = 0;
 					// distance to further box
@@ -154,12 +149,12 @@ void ANNkd_split::ann_pri_search(ANNdist box_dist)
 		ANN_DIFF(ANN_POW(box_diff), ANN_POW(cut_diff)));
 
 	if (child[HI] != KD_TRIVIAL)	// enqueue if not trivial
-	    ANNprBoxPQ->insert(new_dist, child[HI]);
+	    ctx.boxPQ->insert(new_dist, child[HI]);
 					// continue with closer child
-	child[LO]->ann_pri_search(box_dist);
+	child[LO]->ann_pri_search(box_dist, ctx);
     }
     else {				// right of cutting plane
-	ANNcoord box_diff = ANNprQ[cut_dim] - cd_bnds[HI];
+	ANNcoord box_diff = ctx.q[cut_dim] - cd_bnds[HI];
 	if (box_diff < 0)		// within bounds - ignore
 	    box_diff = 0;
 					// distance to further box
@@ -167,9 +162,9 @@ void ANNkd_split::ann_pri_search(ANNdist box_dist)
 		ANN_DIFF(ANN_POW(box_diff), ANN_POW(cut_diff)));
 
 	if (child[LO] != KD_TRIVIAL)	// enqueue if not trivial
-	    ANNprBoxPQ->insert(new_dist, child[LO]);
+	    ctx.boxPQ->insert(new_dist, child[LO]);
 					// continue with closer child
-	child[HI]->ann_pri_search(box_dist);
+	child[HI]->ann_pri_search(box_dist, ctx);
     }
     SPL(1)				// one more splitting node visited
     FLOP(8)				// increment floating ops
@@ -181,7 +176,7 @@ void ANNkd_split::ann_pri_search(ANNdist box_dist)
 //	This is virtually identical to the ann_search for standard search.
 //----------------------------------------------------------------------
 
-void ANNkd_leaf::ann_pri_search(ANNdist box_dist)
+void ANNkd_leaf::ann_pri_search(ANNdist box_dist, ANNkdSearchCtx& ctx)
 {
     register ANNdist dist;		// distance to data point
     register ANNcoord* pp;		// data coordinate pointer
@@ -190,16 +185,17 @@ void ANNkd_leaf::ann_pri_search(ANNdist box_dist)
     register ANNcoord t;
     register int d;
 
-    min_dist = ANNprPointMK->max_key();	// k-th smallest distance so far
+    ANNmin_k* pointMK = ctx.pointMK;
+    min_dist = pointMK->max_key();	// k-th smallest distance so far
 
     for (int i = 0; i < n_pts; i++) 
 		{	// check points in bucket
 
-			pp = ANNprPts[bkt[i]];		// first coord of next data point
-			qq = ANNprQ; 	    		// first coord of query point
+			pp = ctx.pts[bkt[i]];		// first coord of next data point
+			qq = ctx.q; 	    		// first coord of query point
 			dist = 0;
 
-			for(d = 0; d < ANNprDim; d++) 
+			for(d = 0; d < ctx.dim; d++) 
 			{
 					COORD(1)			// one more coordinate hit
 					FLOP(4)			// increment floating ops
@@ -212,15 +208,15 @@ void ANNkd_leaf::ann_pri_search(ANNdist box_dist)
 					}
 			}
 
-			if (d >= ANNprDim &&			// among the k best?
+			if (d >= ctx.dim &&			// among the k best?
 				 (ANN_ALLOW_SELF_MATCH || dist!=0)) 
 			{	// and no self-match problem
 								// add it to the list
-					ANNprPointMK->insert(dist, bkt[i]);
-					min_dist = ANNprPointMK->max_key();
+					pointMK->insert(dist, bkt[i]);
+					min_dist = pointMK->max_key();
 			}
     }
     LEAF(1)				// one more leaf node visited
     PTS(n_pts)				// increment points visited
-    ANNptsVisited += n_pts;		// increment number of points visited
+    ctx.ptsVisited += n_pts;		// increment number of points visited
 }
@@ -30,17 +30,8 @@
 #include "pr_queue_k.h"			// k-element priority queue
 
 //----------------------------------------------------------------------
-//  Global variables
-//	Active for the life of each call to Appx_Near_Neigh() or
-//	Appx_k_Near_Neigh().
+//  The state of a search is passed down in an ANNkdSearchCtx (see
+//  kd_tree.h) rather than kept in globals.
 //----------------------------------------------------------------------
 
-extern double		ANNprEps;	// the error bound
-extern int		ANNprDim;	// dimension of space
-extern ANNpoint		ANNprQ;		// query point
-extern double		ANNprMaxErr;	// max tolerable squared error
-extern ANNpointArray	ANNprPts;	// the points
-extern ANNpr_queue	*ANNprBoxPQ;	// priority queue for boxes
-extern ANNmin_k		*ANNprPointMK;	// set of k closest points
-
 #endif
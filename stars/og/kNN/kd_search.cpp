@@ -73,17 +73,12 @@
 //----------------------------------------------------------------------
 
 //----------------------------------------------------------------------
-//	To keep argument lists short, a number of global variables
-//	are maintained which are common to all the recursive calls.
-//	These are given below.
+//	The values common to all the recursive calls (dimension, query
+//	point, error bound, points and the set of k closest points) are
+//	passed down in an ANNkdSearchCtx, which lives on the stack of
+//	annkSearch(), so concurrent searches do not share any state.
 //----------------------------------------------------------------------
 
-int						ANNkdDim;				// dimension of space
-ANNpoint			ANNkdQ;					// query point
-double				ANNkdMaxErr;		// max tolerable squared error
-ANNpointArray	ANNkdPts;				// the points
-ANNmin_k		 *ANNkdPointMK;		// set of k closest points
-
 //----------------------------------------------------------------------
 //  annkSearch - search for the k nearest neighbors
 //----------------------------------------------------------------------
@@ -98,49 +93,53 @@ void ANNkd_tree::annkSearch(
 
 {
 
-	ANNkdDim = dim;			// copy arguments to static equivs
-	ANNkdQ	 = q;
-	ANNkdPts = pts;
-	ANNptsVisited = 0;			// initialize count of points visited
+	ANNkdSearchCtx ctx;			// state of this search
+	ctx.dim = dim;
+	ctx.q	 = q;
+	ctx.pts = pts;
+	ctx.method = method;
+	ctx.boxPQ = NULL;
+	ctx.sqRad = 0;
+	ctx.ptsVisited = 0;			// initialize count of points visited
+	ctx.ptsInRange = 0;
 
 	if (k > n_pts) 
 	{			// too many near neighbors?
 		annError("Requesting more near neighbors than data points", ANNabort);
 	}
 
-	ANNkdMaxErr = ANN_POW(1.0 + eps);
+	ctx.maxErr = ANN_POW(1.0 + eps);
 	FLOP(2)				// increment floating op count
 
-	ANNkdPointMK = new ANNmin_k(k);	// create set for closest k points
+	ANNmin_k pointMK(k);		// set for closest k points
+	ctx.pointMK = &pointMK;
 	// search starting at the root
-	root->ann_search(annBoxDistance(q, bnd_box_lo, bnd_box_hi, dim), method);
+	root->ann_search(annBoxDistance(q, bnd_box_lo, bnd_box_hi, dim), ctx);
 
 	for (int i = 0; i < k; i++) 
 	{	// extract the k-th closest points
-		dd[i] = ANNkdPointMK->ith_smallest_key(i);
-		nn_idx[i] = ANNkdPointMK->ith_smallest_info(i);
+		dd[i] = pointMK.ith_smallest_key(i);
+		nn_idx[i] = pointMK.ith_smallest_info(i);
 	}
-	delete ANNkdPointMK;		// deallocate closest point set
-	ANNkdPointMK = NULL;
 }
 
 //----------------------------------------------------------------------
 //  kd_split::ann_search - search a splitting node
 //----------------------------------------------------------------------
 
-void ANNkd_split::ann_search(ANNdist box_dist, int method)
+void ANNkd_split::ann_search(ANNdist box_dist, ANNkdSearchCtx& ctx)
 {
 	// check dist calc termination condition
-	if (ANNmaxPtsVisited && ANNptsVisited > ANNmaxPtsVisited) return;
+	if (ANNmaxPtsVisited && ctx.ptsVisited > ANNmaxPtsVisited) return;
 
 	// distance to cutting plane
-	ANNcoord cut_diff = ANNkdQ[cut_dim] - cut_val;
+	ANNcoord cut_diff = ctx.q[cut_dim] - cut_val;
 
 	if (cut_diff < 0) 
 	{			// left of cutting plane
-		child[LO]->ann_search(box_dist, method);// visit closer child first
+		child[LO]->ann_search(box_dist, ctx);// visit closer child first
 
-		ANNcoord box_diff = cd_bnds[LO] - ANNkdQ[cut_dim];
+		ANNcoord box_diff = cd_bnds[LO] - ctx.q[cut_dim];
 		if (box_diff < 0)		// within bounds - ignore
 		box_diff = 0;
 		// distance to further box
@@ -148,15 +147,15 @@ void ANNkd_split::ann_search(ANNdist box_dist, int method)
 		            ANN_DIFF(ANN_POW(box_diff), ANN_POW(cut_diff)));
 
 		// visit further child if close enough
-		if (box_dist * ANNkdMaxErr < ANNkdPointMK->max_key())
-			child[HI]->ann_search(box_dist, method);
+		if (box_dist * ctx.maxErr < ctx.pointMK->max_key())
+			child[HI]->ann_search(box_dist, ctx);
 
 	}
 	else 
 	{				// right of cutting plane
-		child[HI]->ann_search(box_dist, method);// visit closer child first
+		child[HI]->ann_search(box_dist, ctx);// visit closer child first
 
-		ANNcoord box_diff = ANNkdQ[cut_dim] - cd_bnds[HI];
+		ANNcoord box_diff = ctx.q[cut_dim] - cd_bnds[HI];
 		if (box_diff < 0)		// within bounds - ignore
 		box_diff = 0;
 		// distance to further box
@@ -164,8 +163,8 @@ void ANNkd_split::ann_search(ANNdist box_dist, int method)
 		            ANN_DIFF(ANN_POW(box_diff), ANN_POW(cut_diff)));
 
 		// visit further child if close enough
-		if (box_dist * ANNkdMaxErr < ANNkdPointMK->max_key())
-			child[LO]->ann_search(box_dist, method);
+		if (box_dist * ctx.maxErr < ctx.pointMK->max_key())
+			child[LO]->ann_search(box_dist, ctx);
 	}
 	FLOP(10)				// increment floating ops
 	SPL(1)				// one more splitting node visited
@@ -180,7 +179,7 @@ void ANNkd_split::ann_search(ANNdist box_dist, int method)
 
 // adding ArcDist computation
 
-void ANNkd_leaf::ann_search(ANNdist box_dist, int method)
+void ANNkd_leaf::ann_search(ANNdist box_dist, ANNkdSearchCtx& ctx)
 {
 	register ANNdist dist;		// distance to data point
 	register ANNcoord* pp;		// data coordinate pointer
@@ -189,19 +188,20 @@ void ANNkd_leaf::ann_search(ANNdist box_dist, int method)
 	register ANNcoord t;
 	register int d;
 
-	min_dist = ANNkdPointMK->max_key();	// k-th smallest distance so far
+	ANNmin_k* pointMK = ctx.pointMK;
+	min_dist = pointMK->max_key();	// k-th smallest distance so far
   int i = 0;
-	switch (method)
+	switch (ctx.method)
 	{
 		case 1: // Euclidean Distance
 			for (i = 0; i < n_pts; i++) 
 			{	// check points in bucket
 
-				pp = ANNkdPts[bkt[i]];		// first coord of next data point
-				qq = ANNkdQ; 	    		// first coord of query point
+				pp = ctx.pts[bkt[i]];		// first coord of next data point
+				qq = ctx.q; 	    		// first coord of query point
 				dist = 0;
 
-				for(d = 0; d < ANNkdDim; d++) 
+				for(d = 0; d < ctx.dim; d++) 
 				{
 					COORD(1)			// one more coordinate hit
 					FLOP(4)			// increment floating ops
@@ -214,12 +214,12 @@ void ANNkd_leaf::ann_search(ANNdist box_dist, int method)
 					}
 				}
 
-				if (d >= ANNkdDim &&			// among the k best?
+				if (d >= ctx.dim &&			// among the k best?
 				(ANN_ALLOW_SELF_MATCH || dist!=0)) 
 				{	// and no self-match problem
 					// add it to the list
-					ANNkdPointMK->insert(dist, bkt[i]);
-					min_dist = ANNkdPointMK->max_key();
+					pointMK->insert(dist, bkt[i]);
+					min_dist = pointMK->max_key();
 				}
 			}
 			break;
@@ -227,12 +227,12 @@ void ANNkd_leaf::ann_search(ANNdist box_dist, int method)
 			for (i = 0; i < n_pts; i++) 
 			{	// check points in bucket
 
-				pp = ANNkdPts[bkt[i]];		// first coord of next data point
-				qq = ANNkdQ; 	    		// first coord of query point
+				pp = ctx.pts[bkt[i]];		// first coord of next data point
+				qq = ctx.q; 	    		// first coord of query point
 				dist = 0;
 				double x[4];
 
-				for(d = 0; d < ANNkdDim; d++) 
+				for(d = 0; d < ctx.dim; d++) 
 				{
 					COORD(1)			// one more coordinate hit
 					FLOP(4)			// increment floating ops
@@ -250,8 +250,8 @@ void ANNkd_leaf::ann_search(ANNdist box_dist, int method)
 				if (ANN_ALLOW_SELF_MATCH || dist!=0) 
 				{	// and no self-match problem
 					// add it to the list
-					ANNkdPointMK->insert(dist, bkt[i]);
-					min_dist = ANNkdPointMK->max_key();
+					pointMK->insert(dist, bkt[i]);
+					min_dist = pointMK->max_key();
 				}
 			}
 			
@@ -262,9 +262,6 @@ void ANNkd_leaf::ann_search(ANNdist box_dist, int method)
 
 	LEAF(1)				// one more leaf node visited
 	PTS(n_pts)				// increment points visited
-	ANNptsVisited += n_pts;		// increment number of points visited
-
-	char buf[333];
-	sprintf(buf,"Visited: %d, %f\n",n_pts,min_dist);
+	ctx.ptsVisited += n_pts;		// increment number of points visited
 }
 
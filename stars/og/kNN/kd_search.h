@@ -30,18 +30,8 @@
 #include "ANNperf.h"		// performance evaluation
 
 //----------------------------------------------------------------------
-//  More global variables
-//	These are active for the life of each call to Appx_Near_Neigh()
-//	or Appx_k_Near_Neigh().  They are set to save the number of
-//	variables that need to be passed among the various search
-//	procedures.
+//  The state of a search is passed down in an ANNkdSearchCtx (see
+//  kd_tree.h) rather than kept in globals.
 //----------------------------------------------------------------------
 
-extern int		ANNkdDim;	// dimension of space (static copy)
-extern ANNpoint		ANNkdQ;		// query point (static copy)
-extern double		ANNkdMaxErr;	// max tolerable squared error
-extern ANNpointArray	ANNkdPts;	// the points (static copy)
-extern ANNmin_k		*ANNkdPointMK;	// set of k closest points
-extern int		ANNptsVisited;	// number of points visited
-
 #endif
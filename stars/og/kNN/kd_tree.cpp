@@ -27,6 +27,7 @@
 #include "kd_split.h"			// kd-tree splitting rules
 #include "kd_util.h"			// kd-tree utilities
 #include "ANNperf.h"		// performance evaluation
+#include "../GenThreads.h"		// build threads
 
 //----------------------------------------------------------------------
 //  Global data
@@ -37,12 +38,12 @@
 //  contains no points.  For messy coding reasons it is convenient
 //  to have it reference a trivial point index.
 //
-//  KD_TRIVIAL is allocated when the first kd-tree is created.  It
-//  must *never* deallocated (since it may be shared by more than
-//  one tree).
+//  KD_TRIVIAL is allocated at static initialization, so trees can
+//  be built on several threads at once.  It must *never* deallocated
+//  (since it may be shared by more than one tree).
 //----------------------------------------------------------------------
 static int  		IDX_TRIVIAL[] = {0};	// trivial point index
-ANNkd_leaf		*KD_TRIVIAL = NULL;	// trivial leaf node
+ANNkd_leaf		*KD_TRIVIAL = new ANNkd_leaf(0, IDX_TRIVIAL);
 
 //----------------------------------------------------------------------
 //  Printing the kd-tree 
@@ -144,8 +145,6 @@ void ANNkd_tree::SkeletonTree(		// construct skeleton tree
 	pidx[i] = i;			// initially identity
     }
     bnd_box_lo = bnd_box_hi = NULL;	// bounding box is nonexistent
-    if (KD_TRIVIAL == NULL)		// no trivial leaf node yet?
-	KD_TRIVIAL = new ANNkd_leaf(0, IDX_TRIVIAL);	// allocate it
 }
 
 ANNkd_tree::ANNkd_tree(			// basic constructor
@@ -235,12 +234,90 @@ ANNkd_ptr rkd_tree(		// recursive construction of kd-tree
     }
 } 
 
+//----------------------------------------------------------------------
+//  prkd_tree - parallel construction of a kd-tree
+//
+//	Above KD_PAR_CUTOFF points the two subtrees of a splitting node
+//	are built at the same time, the low one on a new thread, each
+//	with half of the threads.  A splitting routine only permutes
+//	its own part of pidx, and each subtree gets its own copy of the
+//	bounding box, so the tree is exactly the one rkd_tree builds.
+//----------------------------------------------------------------------
+
+const int KD_PAR_CUTOFF = 20000;	// smallest subtree given a thread
+
+class ANNkd_builder : public GenThread {	// builds one subtree
+public:
+    ANNkd_builder(
+	ANNpointArray		pa,		// point array
+	ANNidxArray		pidx,		// point indices of the subtree
+	int			n,		// number of points
+	int			dim,		// dimension of space
+	int			bsp,		// bucket space
+	const ANNorthRect	&bnd_box,	// bounding box (copied)
+	ANNkd_splitter		splitter,	// splitting routine
+	int			nthreads)	// threads to use
+    : pa(pa), pidx(pidx), n(n), dim(dim), bsp(bsp), bnd_box(dim, bnd_box),
+      splitter(splitter), nthreads(nthreads), root(NULL) {}
+protected:
+    void run()
+    {  root = prkd_tree(pa, pidx, n, dim, bsp, bnd_box, splitter, nthreads);  }
+private:
+    ANNpointArray	pa;
+    ANNidxArray		pidx;
+    int			n, dim, bsp;
+    ANNorthRect		bnd_box;
+    ANNkd_splitter	splitter;
+    int			nthreads;
+public:
+    ANNkd_ptr		root;		// the subtree, once run
+};
+
+ANNkd_ptr prkd_tree(		// parallel construction of kd-tree
+    ANNpointArray	pa,		// point array
+    ANNidxArray		pidx,		// point indices to store in subtree
+    int			n,		// number of points
+    int			dim,		// dimension of space
+    int			bsp,		// bucket space
+    ANNorthRect		&bnd_box,	// bounding box for current node
+    ANNkd_splitter	splitter,	// splitting routine
+    int			nthreads)	// threads to use
+{
+    if (nthreads < 2 || n < KD_PAR_CUTOFF || n <= bsp)
+	return rkd_tree(pa, pidx, n, dim, bsp, bnd_box, splitter);
+
+    int cd;				// cutting dimension
+    ANNcoord cv;			// cutting value
+    int n_lo;				// number on low side of cut
+    (*splitter)(pa, pidx, bnd_box, n, dim, cd, cv, n_lo);
+
+    ANNcoord lv = bnd_box.lo[cd];	// save bounds for cutting dimension
+    ANNcoord hv = bnd_box.hi[cd];
+
+    bnd_box.hi[cd] = cv;		// bounds of the low subtree
+    ANNkd_builder lo(pa, pidx, n_lo, dim, bsp, bnd_box, splitter,
+	nthreads/2);
+    bnd_box.hi[cd] = hv;
+    bnd_box.lo[cd] = cv;		// bounds of the high subtree
+    ANNkd_builder hi(pa, pidx + n_lo, n-n_lo, dim, bsp, bnd_box, splitter,
+	nthreads - nthreads/2);
+    bnd_box.lo[cd] = lv;		// restore bounds
+
+    std::vector<GenThread*> builders(2);
+    builders[0] = &lo;
+    builders[1] = &hi;			// runs on this thread
+    GenThreads::RunAll(builders);
+
+    return new ANNkd_split(cd, cv, lv, hv, lo.root, hi.root);
+}
+
 //----------------------------------------------------------------------
 // kd-tree constructor
 //	This is the main constructor for kd-trees given a set of points.
 //	It first builds a skeleton tree, then computes the bounding box
-//	of the data points, and then invokes rkd_tree() to actually
+//	of the data points, and then invokes prkd_tree() to actually
 //	build the tree, passing it the appropriate splitting routine.
+//	Any number of threads builds the same tree.
 //----------------------------------------------------------------------
 
 ANNkd_tree::ANNkd_tree(			// construct from point array
@@ -248,7 +325,8 @@ ANNkd_tree::ANNkd_tree(			// construct from point array
     int			n,		// number of points
     int			dd,		// dimension
     int			bs,		// bucket size
-    ANNsplitRule	split)		// splitting method
+    ANNsplitRule	split,		// splitting method
+    int			nthreads)	// build threads (0: all processors)
 {
     SkeletonTree(n, dd, bs);		// set up the basic stuff
     pts = pa;				// where the points are
@@ -260,24 +338,28 @@ ANNkd_tree::ANNkd_tree(			// construct from point array
     bnd_box_lo = annCopyPt(dd, bnd_box.lo);
     bnd_box_hi = annCopyPt(dd, bnd_box.hi);
 
+    ANNkd_splitter splitter = NULL;
     switch (split) {			// build by rule
     case ANN_KD_STD:			// standard kd-splitting rule
-	root = rkd_tree(pa, pidx, n, dd, bs, bnd_box, kd_split);
+	splitter = kd_split;
 	break;
     case ANN_KD_MIDPT:			// midpoint split
-	root = rkd_tree(pa, pidx, n, dd, bs, bnd_box, midpt_split);
+	splitter = midpt_split;
 	break;
     case ANN_KD_FAIR:			// fair split
-	root = rkd_tree(pa, pidx, n, dd, bs, bnd_box, fair_split);
+	splitter = fair_split;
 	break;
     case ANN_KD_SUGGEST:		// best (in our opinion)
     case ANN_KD_SL_MIDPT:		// sliding midpoint split
-	root = rkd_tree(pa, pidx, n, dd, bs, bnd_box, sl_midpt_split);
+	splitter = sl_midpt_split;
 	break;
     case ANN_KD_SL_FAIR:		// sliding fair split
-	root = rkd_tree(pa, pidx, n, dd, bs, bnd_box, sl_fair_split);
+	splitter = sl_fair_split;
 	break;
     default:
 	annError("Illegal splitting method", ANNabort);
+	return;
     }
+    if (nthreads <= 0) nthreads = GenThreads::NumThreads();
+    root = prkd_tree(pa, pidx, n, dd, bs, bnd_box, splitter, nthreads);
 }
@@ -2,12 +2,37 @@
 #ifndef ANN_kd_tree_H
 #define ANN_kd_tree_H
 
+class ANNmin_k;
+class ANNpr_queue;
+
+//----------------------------------------------------------------------
+//	ANNkdSearchCtx
+//		The state shared by the recursive calls of one search, which
+//		Release 0.1 kept in file-scope globals.  Each annkSearch(),
+//		annkPriSearch() and annkFRSearch() call has its own on the
+//		stack, so any number of threads may search one tree at once.
+//----------------------------------------------------------------------
+
+struct ANNkdSearchCtx {
+    int			dim;		// dimension of space
+    ANNpoint		q;		// query point
+    double		maxErr;		// max tolerable squared error
+    ANNpointArray	pts;		// the points
+    int			method;		// 1: Euclidean, 2: arc distance
+    ANNmin_k		*pointMK;	// set of k closest points
+    ANNpr_queue		*boxPQ;		// priority queue for boxes
+    ANNdist		sqRad;		// squared radius (fixed-radius search)
+    int			ptsVisited;	// points visited
+    int			ptsInRange;	// points in the radius
+};
+
 class ANNkd_node{			// generic kd-tree node (empty shell)
 public:
     virtual ~ANNkd_node() {}			// virtual distroyer
 
-    virtual void ann_search(ANNdist, int) = 0;	// tree search
-    virtual void ann_pri_search(ANNdist) = 0;	// priority search
+    virtual void ann_search(ANNdist, ANNkdSearchCtx&) = 0;	// tree search
+    virtual void ann_pri_search(ANNdist, ANNkdSearchCtx&) = 0;	// priority search
+    virtual void ann_FR_search(ANNdist, ANNkdSearchCtx&) = 0;	// fixed-radius search
 
 
     friend class ANNkd_tree;			// allow kd-tree to access us
@@ -39,8 +64,9 @@ public:
   ~ANNkd_leaf() { }			// destructor (none)
 //	ANNkd_leaf::CalcLatLongDist(double lat1, double long1, double lat2, double long2) ;
 
-  virtual void ann_search(ANNdist, int);		// standard search routine
-  virtual void ann_pri_search(ANNdist);	// priority search routine
+  virtual void ann_search(ANNdist, ANNkdSearchCtx&);	// standard search routine
+  virtual void ann_pri_search(ANNdist, ANNkdSearchCtx&);	// priority search routine
+  virtual void ann_FR_search(ANNdist, ANNkdSearchCtx&);	// fixed-radius search routine
 };
 
 //----------------------------------------------------------------------
@@ -97,8 +123,9 @@ public:
 		child[HI] = NULL;
 	}
 
-    virtual void ann_search(ANNdist, int);		// standard search routine
-    virtual void ann_pri_search(ANNdist);	// priority search routine
+    virtual void ann_search(ANNdist, ANNkdSearchCtx&);	// standard search routine
+    virtual void ann_pri_search(ANNdist, ANNkdSearchCtx&);	// priority search routine
+    virtual void ann_FR_search(ANNdist, ANNkdSearchCtx&);	// fixed-radius search routine
 };
 
 //----------------------------------------------------------------------
@@ -114,4 +141,14 @@ ANNkd_ptr rkd_tree(		// recursive construction of kd-tree
     ANNorthRect		&bnd_box,	// bounding box for current node
     ANNkd_splitter	splitter);	// splitting routine
 
+ANNkd_ptr prkd_tree(		// rkd_tree on up to nthreads threads
+    ANNpointArray	pa,		// point array (unaltered)
+    ANNidxArray		pidx,		// point indices to store in subtree
+    int			n,		// number of points
+    int			dim,		// dimension of space
+    int			bsp,		// bucket space
+    ANNorthRect		&bnd_box,	// bounding box for current node
+    ANNkd_splitter	splitter,	// splitting routine
+    int			nthreads);	// threads to use
+
 #endif
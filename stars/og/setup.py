@@ -16,14 +16,25 @@ extensions = [Extension('_OGWrapper',
                             'ShapeOperations/AbstractShape.cpp',
                             'ShapeOperations/BasePoint.cpp',
                             'ShapeOperations/Box.cpp',
+                            'ShapeOperations/DelaunayWeights.cpp',
+                            'ShapeOperations/DynamicKnn.cpp',
                             'ShapeOperations/GalWeight.cpp',
+                            'ShapeOperations/GalCompressed.cpp',
+                            'ShapeOperations/GalReorder.cpp',
+                            'ShapeOperations/GalLattice.cpp',
                             'ShapeOperations/GwtWeight.cpp',
+                            'ShapeOperations/KernelWeights.cpp',
+                            'ShapeOperations/PackedRTree.cpp',
                             'ShapeOperations/ShapeFile.cpp',
                             'ShapeOperations/ShapeFileHdr.cpp',
+                            'ShapeOperations/ThresholdWeights.cpp',
+                            'ShapeOperations/WeightsWriter.cpp',
+                            'ShapeOperations/KdTree2D.cpp',
                             'ShapeOperations/shp2cnt.cpp',
                             'ShapeOperations/shp2gwt.cpp',
                             'ShapeOperations/ShpFile.cpp',
                             'ShapeOperations/shp.cpp',
+                            'ShapeOperations/SpaceTimeWeights.cpp',
                             'logger.cpp',
                             'GenGeomAlgs.cpp',
                             'GenUtils.cpp',
@@ -32,6 +43,7 @@ extensions = [Extension('_OGWrapper',
                             'kNN/kd_tree.cpp',
                             'kNN/kd_search.cpp',
                             'kNN/kd_pr_search.cpp',
+                            'kNN/kd_fix_rad_search.cpp',
                             'kNN/kd_split.cpp',
                             'kNN/kd_util.cpp'
                         ],
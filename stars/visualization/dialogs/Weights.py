@@ -565,8 +565,14 @@ class CreatingWeightDlg():
             if dist_type == "Arc Distance":
                 method = 2 
                 
-            self.dist_thres_min = OGComputeCutOffPoint(self.xs, self.ys, method)
-            self.dist_thres_max = OGComputeMaxDistance(self.xs, self.ys ,method)        
+            # largest nearest neighbor distance (no islands) and extent
+            summary = OGComputeKnnDistances(self.xs, self.ys, 1, method, 10,
+                                            self.getKdTreeIndexPath())
+            if len(summary) > 8:
+                self.dist_thres_min = summary[1]
+                self.dist_thres_max = summary[8]
+            else:
+                self.dist_thres_min = self.dist_thres_max = 0.0
         
         self.sld_threshold_dist.SetRange(0,100)
         self.txt_threshold_dist.SetValue('%.5f'%(self.dist_thres_min+1E-5))
@@ -574,6 +580,11 @@ class CreatingWeightDlg():
     def OnDistWeightCho(self, event):
         self.updatePoints()
         
+    def getKdTreeIndexPath(self):
+        # kd-tree of the points for kNN searches, cached next to the
+        # shapefile and rebuilt when the points change
+        return str('%s.kdt' % self.shp_path[:-4])
+        
     def updatePoints(self):
         x_selection = self.cho_x_coord.GetSelection()
         y_selection = self.cho_y_coord.GetSelection()
@@ -775,7 +786,8 @@ class CreatingWeightDlg():
                         raise Exception("k (KNN) should be at least 1!")
                         
                     flag = OGCreateGwt(str(weight_path), str(id_variable),
-                                       self.ids, self.xs, self.ys, .0, k, method)
+                                       self.ids, self.xs, self.ys, .0, k, method,
+                                       -1, 0, 0, 0, self.getKdTreeIndexPath())
                     
                 elif self.rdo_distance.GetValue() == True:
                     if self.xs == None or self.ys==None: